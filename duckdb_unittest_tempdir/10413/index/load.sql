@@ -0,0 +1 @@
+COPY tracking FROM 'duckdb_unittest_tempdir/10413/index/tracking.csv' (FORMAT 'csv', quote '"', delimiter ',', header 1);
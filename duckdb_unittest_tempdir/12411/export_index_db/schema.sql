@@ -0,0 +1,12 @@
+
+
+
+CREATE TABLE idx_tbl(i INTEGER, j INTEGER, k INTEGER);
+CREATE TABLE pk_tbl(id INTEGER PRIMARY KEY, "name" VARCHAR UNIQUE);
+CREATE TABLE fk_tbl(id INTEGER, FOREIGN KEY (id) REFERENCES pk_tbl(id));
+
+
+CREATE INDEX idx_1 ON idx_tbl(i, k);
+CREATE INDEX idx_2 ON idx_tbl(i);
+
+
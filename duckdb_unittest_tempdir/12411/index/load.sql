@@ -0,0 +1 @@
+COPY tracking FROM 'duckdb_unittest_tempdir/12411/index/tracking.csv' (FORMAT 'csv', quote '"', delimiter ',', header 1);
@@ -0,0 +1,263 @@
+#include "http_block_cache.hpp"
+
+#include "crypto.hpp"
+#include "httpfs.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/uuid.hpp"
+
+#include <ctime>
+
+namespace duckdb {
+
+static constexpr const char *BLOCK_EXTENSION = ".block";
+static constexpr const char *TEMPORARY_EXTENSION = ".tmp";
+// Temporary files of processes that crashed while writing a block are removed after a day
+static constexpr time_t TEMPORARY_FILE_MAX_AGE = 24 * 60 * 60;
+
+HTTPBlockCache::HTTPBlockCache(string directory_p, idx_t max_size_p)
+    : fs(FileSystem::CreateLocal()), directory(std::move(directory_p)), max_size(max_size_p), total_size(0) {
+	if (!fs->DirectoryExists(directory)) {
+		try {
+			fs->CreateDirectory(directory);
+		} catch (std::exception &ex) {
+			// another process may have created the directory in the meantime
+			if (!fs->DirectoryExists(directory)) {
+				throw IOException("Failed to create the HTTP block cache directory \"%s\": %s", directory,
+				                  ErrorData(ex).RawMessage());
+			}
+		}
+	}
+	lock_guard<mutex> guard(lock);
+	ScanDirectory();
+	if (total_size > max_size) {
+		EvictBlocks();
+	}
+}
+
+shared_ptr<HTTPBlockCache> HTTPBlockCache::Get(const string &directory, idx_t max_size) {
+	static mutex caches_lock;
+	static unordered_map<string, shared_ptr<HTTPBlockCache>> caches;
+
+	lock_guard<mutex> guard(caches_lock);
+	auto entry = caches.find(directory);
+	if (entry != caches.end()) {
+		lock_guard<mutex> cache_guard(entry->second->lock);
+		entry->second->max_size = max_size;
+		return entry->second;
+	}
+	auto cache = make_shared_ptr<HTTPBlockCache>(directory, max_size);
+	caches[directory] = cache;
+	return cache;
+}
+
+string HTTPBlockCache::GetCacheKey(const string &url, const string &etag, time_t last_modified, idx_t length) {
+	string version;
+	if (!etag.empty()) {
+		version = etag;
+	} else if (last_modified != 0) {
+		version = StringUtil::Format("%lld:%llu", (int64_t)last_modified, length);
+	} else {
+		// we cannot tell whether the file changed
+		return string();
+	}
+	auto key = url + "\n" + version;
+	hash_bytes hash;
+	hash_str hash_hex;
+	sha256(key.c_str(), key.size(), hash);
+	hex256(hash, hash_hex);
+	return string((char *)hash_hex, sizeof(hash_str));
+}
+
+idx_t HTTPBlockCache::GetBlockSize(HTTPFileHandle &handle, idx_t block_idx) {
+	auto block_start = block_idx * BLOCK_SIZE;
+	D_ASSERT(block_start < handle.length);
+	return MinValue<idx_t>(BLOCK_SIZE, handle.length - block_start);
+}
+
+string HTTPBlockCache::GetBlockPath(const string &block_name) {
+	return fs->JoinPath(directory, block_name);
+}
+
+void HTTPBlockCache::Read(HTTPFileHandle &handle, const string &cache_key, data_ptr_t buffer, idx_t nr_bytes,
+                          idx_t location) {
+	if (nr_bytes == 0) {
+		return;
+	}
+	if (location + nr_bytes > handle.length) {
+		throw IOException("Read of %llu bytes at %llu is outside of the file \"%s\"", nr_bytes, location, handle.path);
+	}
+	auto first_block = location / BLOCK_SIZE;
+	auto end_block = (location + nr_bytes - 1) / BLOCK_SIZE + 1;
+	auto block_data = make_unsafe_uniq_array<data_t>((end_block - first_block) * BLOCK_SIZE);
+
+	// read the cached blocks, consecutive blocks that are not cached are fetched with a single request
+	auto missing_start = end_block;
+	for (idx_t block_idx = first_block; block_idx < end_block; block_idx++) {
+		auto block_buffer = block_data.get() + (block_idx - first_block) * BLOCK_SIZE;
+		auto block_name = cache_key + "_" + to_string(block_idx) + BLOCK_EXTENSION;
+		if (!ReadBlock(block_name, block_buffer, GetBlockSize(handle, block_idx))) {
+			if (missing_start == end_block) {
+				missing_start = block_idx;
+			}
+			continue;
+		}
+		if (missing_start != end_block) {
+			auto missing_buffer = block_data.get() + (missing_start - first_block) * BLOCK_SIZE;
+			FetchBlocks(handle, cache_key, missing_start, block_idx, missing_buffer);
+			missing_start = end_block;
+		}
+	}
+	if (missing_start != end_block) {
+		auto missing_buffer = block_data.get() + (missing_start - first_block) * BLOCK_SIZE;
+		FetchBlocks(handle, cache_key, missing_start, end_block, missing_buffer);
+	}
+	memcpy(buffer, block_data.get() + (location - first_block * BLOCK_SIZE), nr_bytes);
+}
+
+bool HTTPBlockCache::ReadBlock(const string &block_name, data_ptr_t buffer, idx_t size) {
+	try {
+		auto handle = fs->OpenFile(GetBlockPath(block_name),
+		                           FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (!handle || NumericCast<idx_t>(fs->GetFileSize(*handle)) != size) {
+			// the block is not cached, or it is incomplete
+			return false;
+		}
+		handle->Read(buffer, size, 0);
+	} catch (std::exception &ex) {
+		// the block might have been evicted by another process while we were reading it
+		return false;
+	}
+	lock_guard<mutex> guard(lock);
+	UseBlock(block_name, size);
+	return true;
+}
+
+void HTTPBlockCache::FetchBlocks(HTTPFileHandle &handle, const string &cache_key, idx_t first_block, idx_t end_block,
+                                 data_ptr_t buffer) {
+	auto &hfs = handle.file_system.Cast<HTTPFileSystem>();
+	auto fetch_start = first_block * BLOCK_SIZE;
+	auto fetch_end = (end_block - 1) * BLOCK_SIZE + GetBlockSize(handle, end_block - 1);
+	hfs.GetRangeRequest(handle, handle.path, {}, fetch_start, char_ptr_cast(buffer), fetch_end - fetch_start);
+
+	for (idx_t block_idx = first_block; block_idx < end_block; block_idx++) {
+		auto block_name = cache_key + "_" + to_string(block_idx) + BLOCK_EXTENSION;
+		WriteBlock(block_name, buffer + (block_idx - first_block) * BLOCK_SIZE, GetBlockSize(handle, block_idx));
+	}
+}
+
+void HTTPBlockCache::WriteBlock(const string &block_name, data_ptr_t buffer, idx_t size) {
+	// write to a temporary file first, so that other processes never read a partially written block
+	auto temp_path = GetBlockPath(block_name + "." + UUID::ToString(UUID::GenerateRandomUUID()) + TEMPORARY_EXTENSION);
+	try {
+		{
+			auto handle = fs->OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+			handle->Write(buffer, size, 0);
+			handle->Close();
+		}
+		fs->MoveFile(temp_path, GetBlockPath(block_name));
+	} catch (std::exception &ex) {
+		// caching is best effort (e.g. the disk might be full), the data has been read already
+		try {
+			fs->RemoveFile(temp_path);
+		} catch (...) { // NOLINT
+		}
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	UseBlock(block_name, size);
+	if (total_size > max_size) {
+		EvictBlocks();
+	}
+}
+
+void HTTPBlockCache::UseBlock(const string &block_name, idx_t size) {
+	auto entry = blocks.find(block_name);
+	if (entry != blocks.end()) {
+		total_size -= entry->second.size;
+		lru.erase(entry->second.lru_position);
+		blocks.erase(entry);
+	}
+	lru.push_front(block_name);
+	blocks[block_name] = BlockEntry {size, lru.begin()};
+	total_size += size;
+}
+
+void HTTPBlockCache::ScanDirectory() {
+	unordered_map<string, bool> present;
+	vector<string> temporary_files;
+	fs->ListFiles(directory, [&](const string &name, bool is_directory) {
+		if (is_directory) {
+			return;
+		}
+		if (StringUtil::EndsWith(name, BLOCK_EXTENSION)) {
+			present[name] = true;
+		} else if (StringUtil::EndsWith(name, TEMPORARY_EXTENSION)) {
+			temporary_files.push_back(name);
+		}
+	});
+
+	// forget about the blocks that have been removed by other processes
+	for (auto it = blocks.begin(); it != blocks.end();) {
+		if (present.find(it->first) != present.end()) {
+			it++;
+			continue;
+		}
+		total_size -= it->second.size;
+		lru.erase(it->second.lru_position);
+		it = blocks.erase(it);
+	}
+	// blocks written by other processes are added as the least recently used ones
+	for (auto &entry : present) {
+		if (blocks.find(entry.first) != blocks.end()) {
+			continue;
+		}
+		try {
+			auto handle = fs->OpenFile(GetBlockPath(entry.first),
+			                           FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+			if (!handle) {
+				continue;
+			}
+			auto size = NumericCast<idx_t>(fs->GetFileSize(*handle));
+			lru.push_back(entry.first);
+			blocks[entry.first] = BlockEntry {size, std::prev(lru.end())};
+			total_size += size;
+		} catch (std::exception &ex) {
+			continue;
+		}
+	}
+	auto now = std::time(nullptr);
+	for (auto &name : temporary_files) {
+		try {
+			auto path = GetBlockPath(name);
+			auto handle = fs->OpenFile(path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+			if (handle && fs->GetLastModifiedTime(*handle) + TEMPORARY_FILE_MAX_AGE < now) {
+				handle.reset();
+				fs->RemoveFile(path);
+			}
+		} catch (std::exception &ex) {
+			continue;
+		}
+	}
+}
+
+void HTTPBlockCache::EvictBlocks() {
+	// other processes that share the directory have added blocks as well
+	ScanDirectory();
+	auto target_size = idx_t(double(max_size) * EVICTION_TARGET);
+	while (total_size > target_size && !lru.empty()) {
+		auto &block_name = lru.back();
+		try {
+			fs->RemoveFile(GetBlockPath(block_name));
+		} catch (std::exception &ex) {
+			// the block might have been evicted by another process already
+		}
+		auto entry = blocks.find(block_name);
+		total_size -= entry->second.size;
+		blocks.erase(entry);
+		lru.pop_back();
+	}
+}
+
+} // namespace duckdb
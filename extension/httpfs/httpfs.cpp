@@ -42,6 +42,8 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	bool enable_server_cert_verification = DEFAULT_ENABLE_SERVER_CERT_VERIFICATION;
 	std::string ca_cert_file;
 	uint64_t hf_max_per_page = DEFAULT_HF_MAX_PER_PAGE;
+	string block_cache_directory;
+	uint64_t block_cache_max_size = DEFAULT_BLOCK_CACHE_MAX_SIZE;
 
 	Value value;
 	if (FileOpener::TryGetCurrentSetting(opener, "http_timeout", value)) {
@@ -71,6 +73,12 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	if (FileOpener::TryGetCurrentSetting(opener, "hf_max_per_page", value)) {
 		hf_max_per_page = value.GetValue<uint64_t>();
 	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_block_cache_directory", value)) {
+		block_cache_directory = value.ToString();
+	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_block_cache_max_size", value)) {
+		block_cache_max_size = DBConfig::ParseMemoryLimit(value.ToString());
+	}
 
 	return {timeout,
 	        retries,
@@ -81,7 +89,9 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	        enable_server_cert_verification,
 	        ca_cert_file,
 	        "",
-	        hf_max_per_page};
+	        hf_max_per_page,
+	        block_cache_directory,
+	        block_cache_max_size};
 }
 
 void HTTPFileSystem::ParseUrl(string &url, string &path_out, string &proto_host_port_out) {
@@ -452,6 +462,11 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 		hfh.file_offset = location + nr_bytes;
 		return;
 	}
+	if (hfh.block_cache) {
+		hfh.block_cache->Read(hfh, hfh.block_cache_key, data_ptr_cast(buffer), NumericCast<idx_t>(nr_bytes), location);
+		hfh.file_offset = location + nr_bytes;
+		return;
+	}
 
 	idx_t to_read = nr_bytes;
 	idx_t buffer_offset = 0;
@@ -622,10 +637,12 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
 
 			if (flags.OpenForReading()) {
 				read_buffer = duckdb::unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
 			}
+			InitializeBlockCache();
 			return;
 		}
 
@@ -731,10 +748,25 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		tm.tm_isdst = 0;
 		last_modified = mktime(&tm);
 	}
+	etag = res->headers["ETag"];
 
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag});
+	}
+	InitializeBlockCache();
+}
+
+void HTTPFileHandle::InitializeBlockCache() {
+	if (http_params.block_cache_directory.empty() || !flags.OpenForReading() || flags.OpenForWriting() ||
+	    cached_file_handle || length == 0) {
+		return;
+	}
+	block_cache_key = HTTPBlockCache::GetCacheKey(path, etag, last_modified, length);
+	if (block_cache_key.empty()) {
+		// we cannot detect changes to this file, so we cannot cache it
+		return;
 	}
+	block_cache = HTTPBlockCache::Get(http_params.block_cache_directory, http_params.block_cache_max_size);
 }
 
 void HTTPFileHandle::InitializeClient(optional_ptr<ClientContext> context) {
@@ -26,6 +26,11 @@ static void LoadInternal(DatabaseInstance &instance) {
 	config.AddExtensionOption("http_retries", "HTTP retries on I/O error", LogicalType::UBIGINT, Value(3));
 	config.AddExtensionOption("http_retry_wait_ms", "Time between retries", LogicalType::UBIGINT, Value(100));
 	config.AddExtensionOption("force_download", "Forces upfront download of file", LogicalType::BOOLEAN, Value(false));
+	config.AddExtensionOption("http_block_cache_directory",
+	                          "Directory of the persistent cache for ranges read from remote files, empty to disable",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_block_cache_max_size", "Maximum size of the persistent cache for remote files",
+	                          LogicalType::VARCHAR, Value("1GB"));
 	// Reduces the number of requests made while waiting, for example retry_wait_ms of 50 and backoff factor of 2 will
 	// result in wait times of  0 50 100 200 400...etc.
 	config.AddExtensionOption("http_retry_backoff", "Backoff factor for exponentially increasing retry wait time",
@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// http_block_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+
+class HTTPFileHandle;
+
+//! A persistent cache for ranges of remote files, stored as fixed-size blocks in a local directory.
+//! Blocks are keyed by the URL and the ETag (or the last modified time and length) of the file, so a file that changed
+//! never reads stale blocks. The directory can be shared by multiple processes: blocks are written to a temporary file
+//! that is moved into place, and blocks that disappear (e.g. because another process evicted them) are fetched again.
+class HTTPBlockCache {
+public:
+	static constexpr idx_t BLOCK_SIZE = 1 << 20; // 1 MiB
+	//! When the cache exceeds its maximum size, we evict blocks until it is below this fraction of the maximum size
+	static constexpr double EVICTION_TARGET = 0.9;
+
+	HTTPBlockCache(string directory, idx_t max_size);
+
+	//! Returns the cache for the directory, the cache is shared by all database instances of this process
+	static shared_ptr<HTTPBlockCache> Get(const string &directory, idx_t max_size);
+	//! Returns the key of a remote file, or an empty string if changes to the file cannot be detected
+	static string GetCacheKey(const string &url, const string &etag, time_t last_modified, idx_t length);
+
+	//! Read [location, location + nr_bytes) of the file, the blocks that are not cached are fetched and cached
+	void Read(HTTPFileHandle &handle, const string &cache_key, data_ptr_t buffer, idx_t nr_bytes, idx_t location);
+
+private:
+	struct BlockEntry {
+		idx_t size;
+		list<string>::iterator lru_position;
+	};
+
+	static idx_t GetBlockSize(HTTPFileHandle &handle, idx_t block_idx);
+	string GetBlockPath(const string &block_name);
+
+	bool ReadBlock(const string &block_name, data_ptr_t buffer, idx_t size);
+	void FetchBlocks(HTTPFileHandle &handle, const string &cache_key, idx_t first_block, idx_t end_block,
+	                 data_ptr_t buffer);
+	void WriteBlock(const string &block_name, data_ptr_t buffer, idx_t size);
+
+	//! Mark the block as the most recently used one
+	void UseBlock(const string &block_name, idx_t size);
+	//! Scan the directory for blocks written by other processes, blocks we have not used are evicted first
+	void ScanDirectory();
+	void EvictBlocks();
+
+	unique_ptr<FileSystem> fs;
+	string directory;
+	idx_t max_size;
+
+	mutex lock;
+	//! The blocks in the order in which they were used, the most recently used block is in front
+	list<string> lru;
+	unordered_map<string, BlockEntry> blocks;
+	idx_t total_size;
+};
+
+} // namespace duckdb
@@ -6,6 +6,7 @@
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "http_block_cache.hpp"
 #include "http_metadata_cache.hpp"
 
 namespace duckdb_httplib_openssl {
@@ -41,6 +42,7 @@ struct HTTPParams {
 	static constexpr bool DEFAULT_KEEP_ALIVE = true;
 	static constexpr bool DEFAULT_ENABLE_SERVER_CERT_VERIFICATION = false;
 	static constexpr uint64_t DEFAULT_HF_MAX_PER_PAGE = 0;
+	static constexpr uint64_t DEFAULT_BLOCK_CACHE_MAX_SIZE = 1ULL << 30; // 1 GiB
 
 	uint64_t timeout;
 	uint64_t retries;
@@ -55,6 +57,10 @@ struct HTTPParams {
 
 	idx_t hf_max_per_page;
 
+	//! The directory of the persistent block cache, the cache is disabled if this is empty
+	string block_cache_directory;
+	idx_t block_cache_max_size;
+
 	static HTTPParams ReadFrom(optional_ptr<FileOpener> opener);
 };
 
@@ -75,6 +81,11 @@ public:
 	FileOpenFlags flags;
 	idx_t length;
 	time_t last_modified;
+	string etag;
+
+	// When the persistent block cache is enabled, ranges are read through the cache
+	shared_ptr<HTTPBlockCache> block_cache;
+	string block_cache_key;
 
 	// When using full file download, the full file will be written to a cached file handle
 	unique_ptr<CachedFileHandle> cached_file_handle;
@@ -100,6 +111,9 @@ public:
 
 protected:
 	virtual void InitializeClient(optional_ptr<ClientContext> client_context);
+
+private:
+	void InitializeBlockCache();
 };
 
 class HTTPFileSystem : public FileSystem {
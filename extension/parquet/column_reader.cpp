@@ -145,10 +145,74 @@ idx_t ColumnReader::MaxRepeat() const {
 }
 
 void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) {
-	if (chunk) {
+	if (!chunk) {
+		return;
+	}
+	if (!offset_index) {
 		uint64_t size = chunk->meta_data.total_compressed_size;
 		transport.RegisterPrefetch(FileOffset(), size, allow_merge);
+		return;
+	}
+	// only register the pages we are going to read, merging consecutive pages into a single range
+	// the range in front of the first data page holds the dictionary page (if any)
+	auto &pages = offset_index->page_locations;
+	idx_t range_start = FileOffset();
+	idx_t range_end = pages[0].offset;
+	for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+		if (skipped_pages[page_idx]) {
+			continue;
+		}
+		auto page_start = NumericCast<idx_t>(pages[page_idx].offset);
+		auto page_end = page_start + NumericCast<idx_t>(pages[page_idx].compressed_page_size);
+		if (page_start != range_end) {
+			if (range_end > range_start) {
+				transport.RegisterPrefetch(range_start, range_end - range_start, allow_merge);
+			}
+			range_start = page_start;
+		}
+		range_end = page_end;
+	}
+	if (range_end > range_start) {
+		transport.RegisterPrefetch(range_start, range_end - range_start, allow_merge);
+	}
+}
+
+void ColumnReader::InitializePageSkipping(const vector<ParquetRowRange> &skipped_rows) {
+	offset_index.reset();
+	skipped_pages.clear();
+	if (!chunk || HasRepeats() || !chunk->__isset.offset_index_offset || skipped_rows.empty()) {
+		// without repeats the values of the column correspond to the rows of the row group
+		return;
+	}
+	auto index = make_uniq<OffsetIndex>();
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	trans.SetLocation(NumericCast<idx_t>(chunk->offset_index_offset));
+	reader.Read(*index, *protocol);
+
+	auto &pages = index->page_locations;
+	auto row_count = NumericCast<idx_t>(chunk->meta_data.num_values);
+	if (pages.empty() || pages[0].first_row_index != 0) {
+		return;
 	}
+	// the skipped row ranges are sorted and do not overlap
+	idx_t range_idx = 0;
+	for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+		auto page_start = NumericCast<idx_t>(pages[page_idx].first_row_index);
+		auto page_end =
+		    page_idx + 1 < pages.size() ? NumericCast<idx_t>(pages[page_idx + 1].first_row_index) : row_count;
+		if (page_end < page_start || page_end > row_count) {
+			// malformed offset index - don't use it
+			skipped_pages.clear();
+			return;
+		}
+		while (range_idx < skipped_rows.size() && skipped_rows[range_idx].end <= page_start) {
+			range_idx++;
+		}
+		bool skipped = range_idx < skipped_rows.size() && skipped_rows[range_idx].start <= page_start &&
+		               skipped_rows[range_idx].end >= page_end;
+		skipped_pages.push_back(skipped);
+	}
+	offset_index = std::move(index);
 }
 
 uint64_t ColumnReader::TotalCompressedSize() {
@@ -236,6 +300,10 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	page_rows_available = 0;
+	pending_skips = 0;
+	offset_index.reset();
+	skipped_pages.clear();
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -582,8 +650,46 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+// Use the offset index to jump directly to the page that contains the row after the skipped values. Returns the
+// number of values that still have to be skipped within that page.
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	auto &pages = offset_index->page_locations;
+	auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	auto target_row = current_row + num_values;
+
+	// find the last page that starts at or before the target row
+	idx_t page_idx = 0;
+	while (page_idx + 1 < pages.size() && NumericCast<idx_t>(pages[page_idx + 1].first_row_index) <= target_row) {
+		page_idx++;
+	}
+	auto page_start = NumericCast<idx_t>(pages[page_idx].first_row_index);
+	if (page_start <= current_row) {
+		// the target row is in the current page
+		return num_values;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	if (trans.GetLocation() < NumericCast<idx_t>(pages[0].offset)) {
+		// we have not started reading the chunk yet - first load the dictionary page in front of the data pages
+		while (page_rows_available == 0 && trans.GetLocation() < NumericCast<idx_t>(pages[0].offset)) {
+			PrepareRead(none_filter);
+		}
+		if (page_rows_available > 0) {
+			// the offset index does not match the pages in the file - skip the values the regular way
+			return num_values;
+		}
+	}
+	trans.SetLocation(NumericCast<idx_t>(pages[page_idx].offset));
+	chunk_read_offset = trans.GetLocation();
+	page_rows_available = 0;
+	group_rows_available -= page_start - current_row;
+	return target_row - page_start;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
+	if (offset_index) {
+		num_values = SkipPages(num_values);
+	}
 
 	dummy_define.zero();
 	dummy_repeat.zero();
@@ -1107,6 +1213,12 @@ void StructColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool a
 	}
 }
 
+void StructColumnReader::InitializePageSkipping(const vector<ParquetRowRange> &skipped_rows) {
+	for (auto &child : child_readers) {
+		child->InitializePageSkipping(skipped_rows);
+	}
+}
+
 uint64_t StructColumnReader::TotalCompressedSize() {
 	uint64_t size = 0;
 	for (auto &child : child_readers) {
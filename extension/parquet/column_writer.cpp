@@ -1,6 +1,9 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bss_encoder.hpp"
+#include "parquet_dbp_encoder.hpp"
+#include "parquet_dlba_encoder.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -31,12 +34,16 @@ namespace duckdb {
 using namespace duckdb_parquet; // NOLINT
 using namespace duckdb_miniz;   // NOLINT
 
+using duckdb_parquet::format::BoundaryOrder;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::PageType;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::Type;
@@ -89,6 +96,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -319,6 +329,7 @@ struct PageInformation {
 	idx_t offset = 0;
 	idx_t row_count = 0;
 	idx_t empty_count = 0;
+	idx_t null_count = 0;
 	idx_t estimated_page_size = 0;
 };
 
@@ -326,6 +337,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of this page, only gathered when writing the page index
+	unique_ptr<ColumnWriterStatistics> page_stats;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -347,6 +360,7 @@ public:
 	vector<PageInformation> page_info;
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
+	unique_ptr<ParquetBloomFilter> bloom_filter;
 	idx_t current_page = 0;
 };
 
@@ -377,6 +391,8 @@ public:
 	static constexpr const idx_t MAX_DICTIONARY_KEY_SIZE = sizeof(uint32_t);
 	//! The size of encoding the string length
 	static constexpr const idx_t STRING_LENGTH_SIZE = sizeof(uint32_t);
+	//! When writing the page index we limit the amount of rows per page, so readers can skip parts of a row group
+	static constexpr const idx_t MAX_INDEXED_PAGE_ROWS = 20000;
 
 public:
 	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override;
@@ -394,11 +410,17 @@ protected:
 	void NextPage(BasicColumnWriterState &state);
 	void FlushPage(BasicColumnWriterState &state);
 
+	//! Whether or not we write the page index (ColumnIndex/OffsetIndex) for this column
+	bool HasPageIndex() const {
+		return max_repeat == 0 && writer.WritePageIndex();
+	}
+	unique_ptr<ColumnIndex> CreateColumnIndex(BasicColumnWriterState &state);
+
 	//! Initializes the state used to track statistics during writing. Only used for scalar types.
 	virtual unique_ptr<ColumnWriterStatistics> InitializeStatsState();
 
 	//! Initialize the writer for a specific page. Only used for scalar types.
-	virtual unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state);
+	virtual unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state, idx_t page_idx);
 
 	//! Flushes the writer for a specific page. Only used for scalar types.
 	virtual void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state);
@@ -408,6 +430,8 @@ protected:
 	//! Writes a (subset of a) vector to the specified serializer. Only used for scalar types.
 	virtual void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                         Vector &vector, idx_t chunk_start, idx_t chunk_end) = 0;
+	//! Inserts the values of a (subset of a) vector into the bloom filter. Only used for scalar types.
+	virtual void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start, idx_t chunk_end);
 
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
@@ -437,13 +461,18 @@ void BasicColumnWriter::RegisterToRowGroup(duckdb_parquet::format::RowGroup &row
 	row_group.columns.push_back(std::move(column_chunk));
 }
 
-unique_ptr<ColumnWriterPageState> BasicColumnWriter::InitializePageState(BasicColumnWriterState &state) {
+unique_ptr<ColumnWriterPageState> BasicColumnWriter::InitializePageState(BasicColumnWriterState &state,
+                                                                         idx_t page_idx) {
 	return nullptr;
 }
 
 void BasicColumnWriter::FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state) {
 }
 
+void BasicColumnWriter::UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start,
+                                          idx_t chunk_end) {
+}
+
 void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
 	auto &col_chunk = state.row_group.columns[state.col_idx];
@@ -457,6 +486,11 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 
 	idx_t vector_index = 0;
 	for (idx_t i = start; i < vcount; i++) {
+		if (HasPageIndex() && state.page_info.back().row_count >= MAX_INDEXED_PAGE_ROWS) {
+			PageInformation new_info;
+			new_info.offset = state.page_info.back().offset + state.page_info.back().row_count;
+			state.page_info.push_back(new_info);
+		}
 		auto &page_info = state.page_info.back();
 		page_info.row_count++;
 		col_chunk.meta_data.num_values++;
@@ -471,6 +505,8 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 				new_info.offset = page_info.offset + page_info.row_count;
 				state.page_info.push_back(new_info);
 			}
+		} else {
+			page_info.null_count++;
 		}
 		vector_index++;
 	}
@@ -485,6 +521,14 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	if (writer.HasBloomFilter(schema_path)) {
+		// size the bloom filter for the number of distinct values (if we know it) or the number of values
+		auto &col_chunk = state.row_group.columns[state.col_idx];
+		auto distinct_count =
+		    HasDictionary(state) ? DictionarySize(state) : NumericCast<idx_t>(col_chunk.meta_data.num_values);
+		state.bloom_filter =
+		    make_uniq<ParquetBloomFilter>(distinct_count, ParquetBloomFilter::DEFAULT_FALSE_POSITIVE_RATIO);
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -508,7 +552,10 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.temp_writer = make_uniq<MemoryStream>();
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
-		write_info.page_state = InitializePageState(state);
+		write_info.page_state = InitializePageState(state, page_idx);
+		if (HasPageIndex()) {
+			write_info.page_stats = InitializeStatsState();
+		}
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -579,6 +626,9 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	if (write_info.page_stats) {
+		state.stats_state->Merge(*write_info.page_stats);
+	}
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.GetPosition() > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -622,8 +672,12 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
-		            offset + write_count);
+		if (state.bloom_filter) {
+			UpdateBloomFilter(state, vector, offset, offset + write_count);
+		}
+		// when writing the page index we gather statistics per page, these are merged when the page is flushed
+		auto stats = write_info.page_stats ? write_info.page_stats.get() : state.stats_state.get();
+		WriteVector(temp_writer, stats, write_info.page_state.get(), vector, offset, offset + write_count);
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -698,6 +752,10 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	unique_ptr<OffsetIndex> offset_index;
+	if (HasPageIndex()) {
+		offset_index = make_uniq<OffsetIndex>();
+	}
 	for (auto &write_info : state.write_info) {
 		// set the data page offset whenever we see the *first* data page
 		if (column_chunk.meta_data.data_page_offset == 0 && (write_info.page_header.type == PageType::DATA_PAGE ||
@@ -712,9 +770,54 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+
+		if (offset_index && write_info.page_header.type == PageType::DATA_PAGE) {
+			// the data pages are in the same order as the page info
+			auto &page_info = state.page_info[offset_index->page_locations.size()];
+			PageLocation location;
+			location.offset = NumericCast<int64_t>(header_start_offset);
+			location.compressed_page_size = NumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			location.first_row_index = NumericCast<int64_t>(page_info.offset);
+			offset_index->page_locations.push_back(location);
+		}
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	if (offset_index || state.bloom_filter) {
+		auto column_index = offset_index ? CreateColumnIndex(state) : nullptr;
+		writer.AddColumnChunkIndexes(state.col_idx, std::move(column_index), std::move(offset_index),
+		                             std::move(state.bloom_filter));
+	}
+}
+
+unique_ptr<ColumnIndex> BasicColumnWriter::CreateColumnIndex(BasicColumnWriterState &state) {
+	auto column_index = make_uniq<ColumnIndex>();
+	column_index->boundary_order = BoundaryOrder::UNORDERED;
+	column_index->__isset.null_counts = true;
+	idx_t page_idx = 0;
+	for (auto &write_info : state.write_info) {
+		if (write_info.page_header.type != PageType::DATA_PAGE) {
+			continue;
+		}
+		auto &page_info = state.page_info[page_idx++];
+		idx_t null_count = 0;
+		for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+			if (state.definition_levels[i] < max_define) {
+				null_count++;
+			}
+		}
+		bool null_page = null_count == page_info.row_count;
+		if (!null_page && !write_info.page_stats->HasStats()) {
+			// a column index requires min/max values for every page that contains values
+			return nullptr;
+		}
+		column_index->null_pages.push_back(null_page);
+		column_index->min_values.push_back(null_page ? string() : write_info.page_stats->GetMinValue());
+		column_index->max_values.push_back(null_page ? string() : write_info.page_stats->GetMaxValue());
+		column_index->null_counts.push_back(NumericCast<int64_t>(null_count));
+	}
+	return column_index;
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -784,6 +887,16 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -877,8 +990,44 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, idx_
 	}
 }
 
+class StandardColumnWriterState : public BasicColumnWriterState {
+public:
+	StandardColumnWriterState(duckdb_parquet::format::RowGroup &row_group, idx_t col_idx)
+	    : BasicColumnWriterState(row_group, col_idx) {
+	}
+	~StandardColumnWriterState() override = default;
+
+	// analysis state: the range of the deltas between subsequent values
+	idx_t analyzed_count = 0;
+	int64_t previous_value = 0;
+	int64_t min_delta = NumericLimits<int64_t>::Maximum();
+	int64_t max_delta = NumericLimits<int64_t>::Minimum();
+
+	//! The encoding of the data pages of this column chunk
+	Encoding::type encoding = Encoding::PLAIN;
+};
+
+template <class TGT>
+class StandardWriterPageState : public ColumnWriterPageState {
+public:
+	//! The physical type in which we compute the deltas of the DELTA_BINARY_PACKED encoding
+	using DBP_TYPE = typename std::conditional<sizeof(TGT) == sizeof(int32_t), int32_t, int64_t>::type;
+
+	StandardWriterPageState(idx_t total_value_count, Encoding::type encoding)
+	    : encoding(encoding), dbp_encoder(total_value_count), bss_encoder(total_value_count, sizeof(TGT)),
+	      written_value(false) {
+	}
+
+	Encoding::type encoding;
+	DbpEncoder<DBP_TYPE> dbp_encoder;
+	BssEncoder bss_encoder;
+	bool written_value;
+};
+
 template <class SRC, class TGT, class OP = ParquetCastOperator>
 class StandardColumnWriter : public BasicColumnWriter {
+	using DBP_TYPE = typename StandardWriterPageState<TGT>::DBP_TYPE;
+
 public:
 	StandardColumnWriter(ParquetWriter &writer, idx_t schema_idx, vector<string> schema_path_p, // NOLINT
 	                     idx_t max_repeat, idx_t max_define, bool can_have_nulls)
@@ -891,10 +1040,144 @@ public:
 		return OP::template InitializeStats<SRC, TGT>();
 	}
 
-	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
+	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override {
+		auto result = make_uniq<StandardColumnWriterState>(row_group, row_group.columns.size());
+		if (writer.GetParquetVersion() != ParquetVersion::V1 && std::is_floating_point<TGT>::value &&
+		    writer.GetCodec() != CompressionCodec::UNCOMPRESSED) {
+			// splitting the bytes of floating point values does not make them smaller by itself,
+			// but it makes them compress a lot better
+			result->encoding = Encoding::BYTE_STREAM_SPLIT;
+		}
+		RegisterToRowGroup(row_group);
+		return std::move(result);
+	}
+
+	bool HasAnalyze() override {
+		// for integers we choose between PLAIN and DELTA_BINARY_PACKED based on the deltas between the values
+		return writer.GetParquetVersion() != ParquetVersion::V1 && std::is_integral<TGT>::value;
+	}
+
+	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		auto &mask = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<SRC>(vector);
+		for (idx_t r = 0; r < count; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			auto value = Load<DBP_TYPE>(const_data_ptr_cast(&target_value));
+			if (state.analyzed_count > 0) {
+				// the deltas wrap around in the physical type, as they do in the encoder
+				using UNSIGNED = typename std::make_unsigned<DBP_TYPE>::type;
+				auto delta = int64_t(DBP_TYPE(UNSIGNED(value) - UNSIGNED(state.previous_value)));
+				state.min_delta = MinValue<int64_t>(state.min_delta, delta);
+				state.max_delta = MaxValue<int64_t>(state.max_delta, delta);
+			}
+			state.previous_value = value;
+			state.analyzed_count++;
+		}
+	}
+
+	void FinalizeAnalyze(ColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		if (state.analyzed_count < 2) {
+			return;
+		}
+		// the deltas are bit-packed relative to the smallest delta of their block, so the width of the overall range
+		// of the deltas is an upper bound for the bits per value. We pick the delta encoding if that beats plain.
+		auto delta_range = uint64_t(state.max_delta) - uint64_t(state.min_delta);
+		idx_t delta_bit_width = 0;
+		while (delta_range != 0) {
+			delta_bit_width++;
+			delta_range >>= 1;
+		}
+		if (delta_bit_width < sizeof(TGT) * 8) {
+			state.encoding = Encoding::DELTA_BINARY_PACKED;
+		}
+	}
+
+	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		return state.encoding;
+	}
+
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p, idx_t page_idx) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		auto &page_info = state.page_info[page_idx];
+		auto value_count = page_info.row_count - (page_info.empty_count + page_info.null_count);
+		return make_uniq<StandardWriterPageState<TGT>>(value_count, state.encoding);
+	}
+
+	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
+		auto &page_state = state_p->Cast<StandardWriterPageState<TGT>>();
+		switch (page_state.encoding) {
+		case Encoding::DELTA_BINARY_PACKED:
+			page_state.dbp_encoder.FinishWrite(temp_writer);
+			break;
+		case Encoding::BYTE_STREAM_SPLIT:
+			page_state.bss_encoder.FinishWrite(temp_writer);
+			break;
+		default:
+			break;
+		}
+	}
+
+	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state_p,
 	                 Vector &input_column, idx_t chunk_start, idx_t chunk_end) override {
+		auto &page_state = page_state_p->Cast<StandardWriterPageState<TGT>>();
 		auto &mask = FlatVector::Validity(input_column);
-		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+		switch (page_state.encoding) {
+		case Encoding::DELTA_BINARY_PACKED: {
+			auto *ptr = FlatVector::GetData<SRC>(input_column);
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+				auto value = Load<DBP_TYPE>(const_data_ptr_cast(&target_value));
+				if (!page_state.written_value) {
+					page_state.dbp_encoder.BeginWrite(temp_writer, value);
+					page_state.written_value = true;
+				} else {
+					page_state.dbp_encoder.WriteValue(temp_writer, value);
+				}
+			}
+			break;
+		}
+		case Encoding::BYTE_STREAM_SPLIT: {
+			auto *ptr = FlatVector::GetData<SRC>(input_column);
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+				if (!page_state.written_value) {
+					page_state.bss_encoder.BeginWrite();
+					page_state.written_value = true;
+				}
+				page_state.bss_encoder.WriteValue(target_value);
+			}
+			break;
+		}
+		default:
+			TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+			break;
+		}
+	}
+
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				state.bloom_filter->FilterInsert(ParquetBloomFilter::Hash<TGT>(target_value));
+			}
+		}
 	}
 
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
@@ -930,6 +1213,12 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -978,7 +1267,7 @@ public:
 		}
 	}
 
-	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state) override {
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state, idx_t page_idx) override {
 		return make_uniq<BooleanWriterPageState>();
 	}
 
@@ -1061,6 +1350,14 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1092,6 +1389,20 @@ public:
 		}
 	}
 
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<hugeint_t>(input_column);
+
+		data_t temp_buffer[16];
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				WriteParquetDecimal(ptr[r], temp_buffer);
+				state.bloom_filter->FilterInsert(ParquetBloomFilter::Hash(temp_buffer, 16));
+			}
+		}
+	}
+
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
 		return sizeof(hugeint_t);
 	}
@@ -1139,6 +1450,20 @@ public:
 		}
 	}
 
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<hugeint_t>(input_column);
+
+		data_t temp_buffer[PARQUET_UUID_SIZE];
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				WriteParquetUUID(ptr[r], temp_buffer);
+				state.bloom_filter->FilterInsert(ParquetBloomFilter::Hash(temp_buffer, PARQUET_UUID_SIZE));
+			}
+		}
+	}
+
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
 		return PARQUET_UUID_SIZE;
 	}
@@ -1181,6 +1506,20 @@ public:
 		}
 	}
 
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<interval_t>(input_column);
+
+		data_t temp_buffer[PARQUET_INTERVAL_SIZE];
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				WriteParquetInterval(ptr[r], temp_buffer);
+				state.bloom_filter->FilterInsert(ParquetBloomFilter::Hash(temp_buffer, PARQUET_INTERVAL_SIZE));
+			}
+		}
+	}
+
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
 		return PARQUET_INTERVAL_SIZE;
 	}
@@ -1243,6 +1582,21 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			has_stats = false;
+			min = string();
+			max = string();
+			return;
+		}
+		if (other.has_stats) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1269,8 +1623,10 @@ public:
 
 class StringWriterPageState : public ColumnWriterPageState {
 public:
-	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values)
-	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false) {
+	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values, bool page_stats,
+	                               Encoding::type encoding, idx_t total_value_count)
+	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false), page_stats(page_stats),
+	      encoding(encoding), dlba_encoder(total_value_count) {
 		D_ASSERT(IsDictionaryEncoded() || (bit_width == 0 && dictionary.empty()));
 	}
 
@@ -1282,6 +1638,11 @@ public:
 	const string_map_t<uint32_t> &dictionary;
 	RleBpEncoder encoder;
 	bool written_value;
+	//! Whether we gather the statistics of this page - dictionary pages otherwise get them from the dictionary
+	bool page_stats;
+	//! The encoding of this page: RLE_DICTIONARY, PLAIN or DELTA_LENGTH_BYTE_ARRAY
+	Encoding::type encoding;
+	DlbaEncoder dlba_encoder;
 };
 
 class StringColumnWriter : public BasicColumnWriter {
@@ -1386,6 +1747,9 @@ public:
 					continue;
 				}
 				auto value_index = page_state.dictionary.at(ptr[r]);
+				if (page_state.page_stats) {
+					stats.Update(ptr[r]);
+				}
 				if (!page_state.written_value) {
 					// first value
 					// write the bit-width as a one-byte entry
@@ -1397,6 +1761,19 @@ public:
 					page_state.encoder.WriteValue(temp_writer, value_index);
 				}
 			}
+		} else if (page_state.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				stats.Update(ptr[r]);
+				if (!page_state.written_value) {
+					page_state.dlba_encoder.BeginWrite(temp_writer, ptr[r]);
+					page_state.written_value = true;
+				} else {
+					page_state.dlba_encoder.WriteValue(temp_writer, ptr[r]);
+				}
+			}
 		} else {
 			// plain page
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
@@ -1410,9 +1787,29 @@ public:
 		}
 	}
 
-	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p, idx_t page_idx) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		auto &page_info = state.page_info[page_idx];
+		auto value_count = page_info.row_count - (page_info.empty_count + page_info.null_count);
+		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary, HasPageIndex(),
+		                                        GetEncoding(state), value_count);
+	}
+
+	void UpdateBloomFilter(BasicColumnWriterState &state_p, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (state.IsDictionaryEncoded()) {
+			// the bloom filter is built from the dictionary instead
+			return;
+		}
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				state.bloom_filter->FilterInsert(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+			}
+		}
 	}
 
 	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
@@ -1425,12 +1822,18 @@ public:
 				return;
 			}
 			page_state.encoder.FinishWrite(temp_writer);
+		} else if (page_state.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+			page_state.dlba_encoder.FinishWrite(temp_writer);
 		}
 	}
 
 	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : Encoding::PLAIN;
+		if (state.IsDictionaryEncoded()) {
+			return Encoding::RLE_DICTIONARY;
+		}
+		// if the dictionary does not pay off, V2 writes the lengths delta encoded instead of interleaved with the data
+		return writer.GetParquetVersion() == ParquetVersion::V1 ? Encoding::PLAIN : Encoding::DELTA_LENGTH_BYTE_ARRAY;
 	}
 
 	bool HasDictionary(BasicColumnWriterState &state_p) override {
@@ -1462,6 +1865,10 @@ public:
 			auto &value = values[r];
 			// update the statistics
 			stats.Update(value);
+			if (state.bloom_filter) {
+				state.bloom_filter->FilterInsert(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(value.GetData()), value.GetSize()));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData(const_data_ptr_cast((value.GetData())), value.GetSize());
@@ -1567,10 +1974,43 @@ public:
 		}
 	}
 
-	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state) override {
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state, idx_t page_idx) override {
 		return make_uniq<EnumWriterPageState>(bit_width);
 	}
 
+	template <class T>
+	void UpdateBloomFilterInternal(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                               idx_t chunk_end) {
+		// the dictionary contains all enum values: only insert the values that actually occur
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<T>(input_column);
+		auto string_values = FlatVector::GetData<string_t>(EnumType::GetValuesInsertOrder(enum_type));
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				auto &value = string_values[ptr[r]];
+				state.bloom_filter->FilterInsert(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(value.GetData()), value.GetSize()));
+			}
+		}
+	}
+
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		switch (enum_type.InternalType()) {
+		case PhysicalType::UINT8:
+			UpdateBloomFilterInternal<uint8_t>(state, input_column, chunk_start, chunk_end);
+			break;
+		case PhysicalType::UINT16:
+			UpdateBloomFilterInternal<uint16_t>(state, input_column, chunk_start, chunk_end);
+			break;
+		case PhysicalType::UINT32:
+			UpdateBloomFilterInternal<uint32_t>(state, input_column, chunk_start, chunk_end);
+			break;
+		default:
+			throw InternalException("Unsupported internal enum type");
+		}
+	}
+
 	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
 		auto &page_state = state_p->Cast<EnumWriterPageState>();
 		if (!page_state.written_value) {
@@ -45,6 +45,10 @@ public:
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 		child_reader->RegisterPrefetch(transport, allow_merge);
 	}
+
+	void InitializePageSkipping(const vector<ParquetRowRange> &skipped_rows) override {
+		child_reader->InitializePageSkipping(skipped_rows);
+	}
 };
 
 } // namespace duckdb
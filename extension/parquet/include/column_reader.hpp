@@ -32,12 +32,19 @@ using duckdb_apache::thrift::protocol::TProtocol;
 using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
 
 typedef std::bitset<STANDARD_VECTOR_SIZE> parquet_filter_t;
 
+//! A range of rows [start, end) within a row group
+struct ParquetRowRange {
+	idx_t start;
+	idx_t end;
+};
+
 class ColumnReader {
 public:
 	ColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t file_idx_p,
@@ -67,6 +74,8 @@ public:
 
 	// register the range this reader will touch for prefetching
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
+	// load the offset index of the column chunk, so pages that only contain skipped rows are never read or fetched
+	virtual void InitializePageSkipping(const vector<ParquetRowRange> &skipped_rows);
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
@@ -141,6 +150,7 @@ private:
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
+	idx_t SkipPages(idx_t num_values);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
 
@@ -151,6 +161,11 @@ private:
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
 
+	// the offset index of the column chunk - only loaded if there are pages that can be skipped
+	unique_ptr<OffsetIndex> offset_index;
+	// for every page in the offset index, whether or not the page only contains skipped rows
+	vector<bool> skipped_pages;
+
 	shared_ptr<ResizeableBuffer> block;
 
 	ResizeableBuffer compressed_buffer;
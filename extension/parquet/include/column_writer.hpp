@@ -49,6 +49,8 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Merges the statistics of a single page into the statistics of the column chunk
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
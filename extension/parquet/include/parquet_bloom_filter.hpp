@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+//! A split block bloom filter (SBBF) as defined by the Parquet format
+//! The filter consists of blocks of 256 bits, every inserted value sets one bit in each of the eight 32-bit words of
+//! a single block. Values are hashed using xxHash64 over their plain encoding.
+class ParquetBloomFilter {
+public:
+	//! Creates a bloom filter sized for the given number of distinct values at the given false positive ratio
+	ParquetBloomFilter(idx_t num_entries, double false_positive_ratio);
+	//! Creates a bloom filter from its serialized bitset
+	ParquetBloomFilter(const_data_ptr_t data, idx_t size);
+
+	//! The size of a single block in bytes
+	static constexpr const idx_t BLOCK_SIZE = 32;
+	//! The upper limit of the bloom filter size
+	static constexpr const idx_t MAX_BLOOM_FILTER_SIZE = 1048576;
+	//! The false positive ratio the bloom filters written by DuckDB are sized for
+	static constexpr const double DEFAULT_FALSE_POSITIVE_RATIO = 0.01;
+
+public:
+	//! Inserts a hash into the filter
+	void FilterInsert(uint64_t hash);
+	//! Returns false if the hash was definitely not inserted into the filter
+	bool FilterCheck(uint64_t hash) const;
+
+	//! Hashes a plain-encoded value
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	template <class T>
+	static uint64_t Hash(const T &value) {
+		return Hash(const_data_ptr_cast(&value), sizeof(T));
+	}
+
+	const_data_ptr_t Data() const {
+		return const_data_ptr_cast(blocks.data());
+	}
+	idx_t Size() const {
+		return blocks.size() * sizeof(uint32_t);
+	}
+
+private:
+	vector<uint32_t> blocks;
+};
+
+} // namespace duckdb
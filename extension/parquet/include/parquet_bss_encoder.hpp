@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bss_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the BYTE_STREAM_SPLIT encoding
+//! Byte i of every value is scattered into stream i, the streams are written back-to-back when the page is flushed
+class BssEncoder {
+public:
+	BssEncoder(idx_t total_value_count_p, idx_t type_size_p)
+	    : total_value_count(total_value_count_p), type_size(type_size_p), count(0) {
+	}
+
+	void BeginWrite() {
+		// the buffer is allocated lazily, so we only hold on to the buffer of the page that is currently being written
+		D_ASSERT(!buffer);
+		buffer = make_unsafe_uniq_array<data_t>(total_value_count * type_size);
+	}
+
+	template <class T>
+	void WriteValue(const T &value) {
+		D_ASSERT(sizeof(T) == type_size && count < total_value_count);
+		auto bytes = const_data_ptr_cast(&value);
+		for (idx_t byte_idx = 0; byte_idx < sizeof(T); byte_idx++) {
+			buffer[byte_idx * total_value_count + count] = bytes[byte_idx];
+		}
+		count++;
+	}
+
+	void FinishWrite(WriteStream &writer) {
+		D_ASSERT(count == total_value_count);
+		if (count > 0) {
+			writer.WriteData(buffer.get(), total_value_count * type_size);
+		}
+		buffer.reset();
+	}
+
+private:
+	idx_t total_value_count;
+	idx_t type_size;
+	idx_t count;
+	unsafe_unique_array<data_t> buffer;
+};
+
+} // namespace duckdb
@@ -0,0 +1,165 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the DELTA_BINARY_PACKED encoding, T is the physical type of the column (int32_t or int64_t)
+//! The deltas wrap around in the domain of T, the decoder wraps around in the same way when adding them up
+template <class T>
+class DbpEncoder {
+	using UNSIGNED = typename std::make_unsigned<T>::type;
+
+public:
+	//! We use the same block layout as most other writers: blocks of 128 values, split into 4 miniblocks
+	static constexpr const idx_t BLOCK_SIZE_IN_VALUES = 128;
+	static constexpr const idx_t NUMBER_OF_MINIBLOCKS = 4;
+	static constexpr const idx_t VALUES_PER_MINIBLOCK = BLOCK_SIZE_IN_VALUES / NUMBER_OF_MINIBLOCKS;
+
+public:
+	explicit DbpEncoder(idx_t total_value_count_p)
+	    : total_value_count(total_value_count_p), count(0), previous_value(0), delta_count(0) {
+	}
+
+	void BeginWrite(WriteStream &writer, T first_value) {
+		D_ASSERT(count == 0);
+		WriteHeader(writer, first_value);
+		previous_value = first_value;
+		count = 1;
+	}
+
+	void WriteValue(WriteStream &writer, T value) {
+		D_ASSERT(count > 0 && count < total_value_count);
+		deltas[delta_count++] = T(UNSIGNED(value) - UNSIGNED(previous_value));
+		previous_value = value;
+		count++;
+		if (delta_count == BLOCK_SIZE_IN_VALUES) {
+			WriteBlock(writer);
+		}
+	}
+
+	void FinishWrite(WriteStream &writer) {
+		D_ASSERT(count == total_value_count);
+		if (count == 0) {
+			// no values: we only write the header
+			WriteHeader(writer, 0);
+			return;
+		}
+		if (delta_count > 0) {
+			WriteBlock(writer);
+		}
+	}
+
+private:
+	//! The total amount of values, this is written in the header
+	idx_t total_value_count;
+	//! The amount of values that have been written so far
+	idx_t count;
+	T previous_value;
+	//! The deltas of the block that is currently being written
+	T deltas[BLOCK_SIZE_IN_VALUES];
+	idx_t delta_count;
+
+private:
+	static void VarintEncode(uint64_t val, WriteStream &writer) {
+		do {
+			uint8_t byte = val & 127;
+			val >>= 7;
+			if (val != 0) {
+				byte |= 128;
+			}
+			writer.Write<uint8_t>(byte);
+		} while (val != 0);
+	}
+
+	static uint64_t IntToZigzag(T val) {
+		return UNSIGNED(UNSIGNED(val) << 1) ^ UNSIGNED(val >> (sizeof(T) * 8 - 1));
+	}
+
+	static uint8_t ComputeBitWidth(UNSIGNED val) {
+		uint8_t width = 0;
+		while (val != 0) {
+			width++;
+			val >>= 1;
+		}
+		return width;
+	}
+
+	void WriteHeader(WriteStream &writer, T first_value) {
+		//<block size in values> <number of miniblocks in a block> <total value count> <first value>
+		VarintEncode(BLOCK_SIZE_IN_VALUES, writer);
+		VarintEncode(NUMBER_OF_MINIBLOCKS, writer);
+		VarintEncode(total_value_count, writer);
+		VarintEncode(IntToZigzag(first_value), writer);
+	}
+
+	void WriteBlock(WriteStream &writer) {
+		D_ASSERT(delta_count > 0);
+		// <min delta> <list of bitwidths of miniblocks> <miniblocks>
+		T min_delta = deltas[0];
+		for (idx_t i = 1; i < delta_count; i++) {
+			if (deltas[i] < min_delta) {
+				min_delta = deltas[i];
+			}
+		}
+		VarintEncode(IntToZigzag(min_delta), writer);
+
+		// subtract the min delta, the last miniblock is padded with zeros
+		UNSIGNED values[BLOCK_SIZE_IN_VALUES];
+		auto miniblock_count = (delta_count + VALUES_PER_MINIBLOCK - 1) / VALUES_PER_MINIBLOCK;
+		for (idx_t i = 0; i < miniblock_count * VALUES_PER_MINIBLOCK; i++) {
+			values[i] = i < delta_count ? UNSIGNED(UNSIGNED(deltas[i]) - UNSIGNED(min_delta)) : 0;
+		}
+
+		// the bit widths of miniblocks without values are written, but their data is omitted
+		uint8_t bit_widths[NUMBER_OF_MINIBLOCKS];
+		for (idx_t miniblock_idx = 0; miniblock_idx < NUMBER_OF_MINIBLOCKS; miniblock_idx++) {
+			UNSIGNED all_bits = 0;
+			if (miniblock_idx < miniblock_count) {
+				for (idx_t i = 0; i < VALUES_PER_MINIBLOCK; i++) {
+					all_bits |= values[miniblock_idx * VALUES_PER_MINIBLOCK + i];
+				}
+			}
+			bit_widths[miniblock_idx] = ComputeBitWidth(all_bits);
+		}
+		writer.WriteData(bit_widths, NUMBER_OF_MINIBLOCKS);
+
+		for (idx_t miniblock_idx = 0; miniblock_idx < miniblock_count; miniblock_idx++) {
+			BitPack(writer, values + miniblock_idx * VALUES_PER_MINIBLOCK, bit_widths[miniblock_idx]);
+		}
+		delta_count = 0;
+	}
+
+	//! Bit-packs a miniblock, starting from the least significant bit. Miniblocks always end on a byte boundary.
+	static void BitPack(WriteStream &writer, const UNSIGNED *values, uint8_t width) {
+		data_t packed[VALUES_PER_MINIBLOCK * sizeof(UNSIGNED)];
+		auto byte_count = VALUES_PER_MINIBLOCK * width / 8;
+		memset(packed, 0, byte_count);
+		idx_t bit_offset = 0;
+		for (idx_t i = 0; i < VALUES_PER_MINIBLOCK; i++) {
+			uint64_t value = values[i];
+			idx_t bit = 0;
+			while (bit < width) {
+				auto shift = bit_offset % 8;
+				auto bits = MinValue<idx_t>(8 - shift, width - bit);
+				packed[bit_offset / 8] |= data_t(((value >> bit) & ((uint64_t(1) << bits) - 1)) << shift);
+				bit += bits;
+				bit_offset += bits;
+			}
+		}
+		writer.WriteData(packed, byte_count);
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,54 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dlba_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "parquet_dbp_encoder.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/memory_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the DELTA_LENGTH_BYTE_ARRAY encoding
+//! The lengths are DELTA_BINARY_PACKED, followed by the concatenated string data
+class DlbaEncoder {
+public:
+	explicit DlbaEncoder(idx_t total_value_count) : length_encoder(total_value_count), has_values(false) {
+	}
+
+	void BeginWrite(WriteStream &writer, const string_t &first_value) {
+		D_ASSERT(!has_values);
+		length_encoder.BeginWrite(writer, NumericCast<int32_t>(first_value.GetSize()));
+		// the string data follows all of the lengths, so we buffer it until the page is flushed
+		string_data = make_uniq<MemoryStream>();
+		string_data->WriteData(const_data_ptr_cast(first_value.GetData()), first_value.GetSize());
+		has_values = true;
+	}
+
+	void WriteValue(WriteStream &writer, const string_t &value) {
+		D_ASSERT(has_values);
+		length_encoder.WriteValue(writer, NumericCast<int32_t>(value.GetSize()));
+		string_data->WriteData(const_data_ptr_cast(value.GetData()), value.GetSize());
+	}
+
+	void FinishWrite(WriteStream &writer) {
+		length_encoder.FinishWrite(writer);
+		if (has_values) {
+			writer.WriteData(string_data->GetData(), string_data->GetPosition());
+			string_data.reset();
+		}
+	}
+
+private:
+	DbpEncoder<int32_t> length_encoder;
+	unique_ptr<MemoryStream> string_data;
+	bool has_values;
+};
+
+} // namespace duckdb
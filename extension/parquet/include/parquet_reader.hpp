@@ -16,6 +16,7 @@
 #include "duckdb/common/multi_file_reader_options.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
@@ -41,10 +42,13 @@ class ClientContext;
 class BaseStatistics;
 class TableFilterSet;
 class ParquetEncryptionConfig;
+class ParquetDecodeBatch;
 
 struct ParquetReaderPrefetchConfig {
 	// Percentage of data in a row group span that should be scanned for enabling whole group prefetch
 	static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
+	// The default amount of background threads that read the prefetched ranges concurrently
+	static constexpr idx_t DEFAULT_PREFETCH_IO_THREADS = 8;
 };
 
 struct ParquetReaderScanState {
@@ -63,6 +67,21 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! The row ranges of the current row group that are skipped because the page index shows they cannot match the
+	//! filters (sorted, aligned to vectors)
+	vector<ParquetRowRange> skipped_rows;
+	idx_t skipped_rows_idx = 0;
+
+	//! If set, the column chunks of a row group may be decoded in parallel using tasks of this scheduler
+	optional_ptr<TaskScheduler> decode_scheduler;
+	//! Whether we decode the column chunks in parallel: every column is read through its own protocol
+	bool parallel_decode = false;
+	unique_ptr<ProducerToken> decode_producer;
+	vector<unique_ptr<duckdb_apache::thrift::protocol::TProtocol>> column_protocols;
+	//! The vectors that have been decoded in parallel, and the next one of them to output
+	shared_ptr<ParquetDecodeBatch> decode_batch;
+	idx_t decode_batch_idx = 0;
 };
 
 struct ParquetColumnDefinition {
@@ -87,6 +106,9 @@ struct ParquetOptions {
 
 	bool binary_as_string = false;
 	bool file_row_number = false;
+	idx_t prefetch_io_threads = ParquetReaderPrefetchConfig::DEFAULT_PREFETCH_IO_THREADS;
+	//! Whether local files are prefetched as well, instead of remote files only
+	bool prefetch_all_files = false;
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 
 	MultiFileReaderOptions file_options;
@@ -125,6 +147,8 @@ public:
 
 	idx_t NumRows();
 	idx_t NumRowGroups();
+	//! Whether a scan of multiple row groups fetches the next row group in the background
+	bool ReadsAhead();
 
 	const duckdb_parquet::format::FileMetaData *GetFileMetadata();
 
@@ -162,6 +186,12 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	// Use the page index of the filtered columns to find the rows of the row group that cannot match the filters
+	void PreparePageSkipping(ParquetReaderScanState &state);
+	// Start reading the next row group in the background, so that it arrives while we decode the current one
+	void PrefetchNextGroup(ParquetReaderScanState &state);
+	// Decode the next vectors of all columns of the current row group in parallel
+	void DecodeBatch(ParquetReaderScanState &state, DataChunk &result);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -172,6 +202,8 @@ private:
 
 private:
 	unique_ptr<FileHandle> file_handle;
+	//! The I/O workers that read the prefetched ranges of the file concurrently
+	shared_ptr<PrefetchIOPool> prefetch_io_pool;
 };
 
 } // namespace duckdb
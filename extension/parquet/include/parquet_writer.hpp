@@ -19,6 +19,7 @@
 #endif
 
 #include "column_writer.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_types.h"
 #include "thrift/protocol/TCompactProtocol.h"
 
@@ -30,12 +31,25 @@ class ParquetEncryptionConfig;
 class Serializer;
 class Deserializer;
 
+//! The version of the Parquet format we write. V2 enables the DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY and
+//! BYTE_STREAM_SPLIT encodings, which not all readers support.
+enum class ParquetVersion : uint8_t { V1 = 1, V2 = 2 };
+
 struct PreparedRowGroup {
 	duckdb_parquet::format::RowGroup row_group;
 	vector<unique_ptr<ColumnWriterState>> states;
 	vector<shared_ptr<StringHeap>> heaps;
 };
 
+//! The page index and bloom filter of a column chunk, these are written after all row groups
+struct ParquetColumnChunkIndexes {
+	idx_t row_group_idx;
+	idx_t column_idx;
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+};
+
 struct FieldID;
 struct ChildFieldIDs {
 	ChildFieldIDs();
@@ -65,7 +79,8 @@ public:
 	              duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level);
+	              optional_idx compression_level, bool write_page_index, const vector<string> &bloom_filter_columns,
+	              ParquetVersion parquet_version);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -98,6 +113,19 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	bool WritePageIndex() const {
+		return write_page_index;
+	}
+	ParquetVersion GetParquetVersion() const {
+		return parquet_version;
+	}
+	bool HasBloomFilter(const vector<string> &schema_path) const {
+		return schema_path.size() == 1 && bloom_filter_columns.find(schema_path[0]) != bloom_filter_columns.end();
+	}
+	//! Adds the page index and bloom filter of a column chunk of the row group that is being flushed
+	void AddColumnChunkIndexes(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+	                           unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index,
+	                           unique_ptr<ParquetBloomFilter> bloom_filter);
 
 	static CopyTypeSupport TypeIsSupported(const LogicalType &type);
 
@@ -107,6 +135,9 @@ public:
 private:
 	static CopyTypeSupport DuckDBTypeToParquetTypeInternal(const LogicalType &duckdb_type,
 	                                                       duckdb_parquet::format::Type::type &type);
+	void WriteColumnChunkIndexes();
+	void WriteBloomFilter(const ParquetBloomFilter &bloom_filter);
+
 	string file_name;
 	vector<LogicalType> sql_types;
 	vector<string> column_names;
@@ -115,6 +146,9 @@ private:
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
+	bool write_page_index;
+	unordered_set<string> bloom_filter_columns;
+	ParquetVersion parquet_version;
 
 	unique_ptr<BufferedFileWriter> writer;
 	std::shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
@@ -122,6 +156,7 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	vector<ParquetColumnChunkIndexes> column_chunk_indexes;
 };
 
 } // namespace duckdb
@@ -35,6 +35,7 @@ public:
 	idx_t GroupRowsAvailable() override;
 	uint64_t TotalCompressedSize() override;
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override;
+	void InitializePageSkipping(const vector<ParquetRowRange> &skipped_rows) override;
 };
 
 } // namespace duckdb
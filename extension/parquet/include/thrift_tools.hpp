@@ -7,10 +7,230 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/storage/object_cache.hpp"
 #endif
 
+#include <condition_variable>
+
 namespace duckdb {
 
+// A pool of file handles of a single file, for reading its ranges concurrently. File handles are not thread-safe (e.g.
+// the HTTP client of an httpfs handle), so every I/O worker reads through its own handle
+class PrefetchHandlePool {
+public:
+	PrefetchHandlePool(FileSystem &fs, string path, FileOpenFlags flags, idx_t max_workers)
+	    : fs(fs), path(std::move(path)), flags(flags), max_workers(max_workers) {
+	}
+
+	// The amount of I/O workers that may read the ranges of this file at the same time
+	idx_t MaxWorkers() const {
+		return max_workers;
+	}
+
+	unique_ptr<FileHandle> AcquireHandle() {
+		{
+			lock_guard<mutex> guard(lock);
+			if (!handles.empty()) {
+				auto handle = std::move(handles.back());
+				handles.pop_back();
+				return handle;
+			}
+		}
+		return fs.OpenFile(path, flags);
+	}
+
+	void ReleaseHandle(unique_ptr<FileHandle> handle) {
+		lock_guard<mutex> guard(lock);
+		handles.push_back(std::move(handle));
+	}
+
+private:
+	FileSystem &fs;
+	string path;
+	FileOpenFlags flags;
+	idx_t max_workers;
+
+	mutex lock;
+	vector<unique_ptr<FileHandle>> handles;
+};
+
+// A byte range that is read by a PrefetchJob
+struct PrefetchRequest {
+	data_ptr_t buffer;
+	idx_t location;
+	idx_t size;
+};
+
+// Reads a set of byte ranges on the workers of the PrefetchIOPool. The thread that waits for the ranges reads the
+// ranges that no worker has claimed yet itself, so it never waits for other jobs that are queued in the pool
+class PrefetchJob {
+public:
+	PrefetchJob(PrefetchHandlePool &handles, vector<PrefetchRequest> requests_p)
+	    : handles(handles), requests(std::move(requests_p)), next_request(0), active_workers(0), cancelled(false) {
+	}
+
+	idx_t RequestCount() const {
+		return requests.size();
+	}
+
+	// Reads the unclaimed ranges on an I/O worker, through a handle of the handle pool
+	void Work() {
+		{
+			lock_guard<mutex> guard(lock);
+			if (cancelled || next_request >= requests.size()) {
+				// the handle pool may no longer exist once the job was cancelled
+				return;
+			}
+			active_workers++;
+		}
+		try {
+			auto handle = handles.AcquireHandle();
+			ReadRequests(*handle);
+			handles.ReleaseHandle(std::move(handle));
+		} catch (std::exception &ex) {
+			lock_guard<mutex> guard(lock);
+			error = ErrorData(ex);
+			cancelled = true;
+		}
+		{
+			lock_guard<mutex> guard(lock);
+			active_workers--;
+		}
+		finished.notify_all();
+	}
+
+	// Waits until all ranges have been read, and throws if any of the reads failed
+	void Wait(FileHandle &handle) {
+		Join(handle);
+		lock_guard<mutex> guard(lock);
+		if (error.HasError()) {
+			error.Throw();
+		}
+	}
+
+	// Waits until all ranges have been read without throwing any errors, reading the unclaimed ranges through handle
+	void Join(FileHandle &handle) {
+		try {
+			ReadRequests(handle);
+		} catch (std::exception &ex) {
+			lock_guard<mutex> guard(lock);
+			error = ErrorData(ex);
+			cancelled = true;
+		}
+		unique_lock<mutex> guard(lock);
+		finished.wait(guard, [&]() { return active_workers == 0; });
+	}
+
+	// Stops reading the unclaimed ranges, and waits until the reads in progress are done
+	void Cancel() {
+		unique_lock<mutex> guard(lock);
+		cancelled = true;
+		finished.wait(guard, [&]() { return active_workers == 0; });
+	}
+
+private:
+	void ReadRequests(FileHandle &handle) {
+		while (true) {
+			idx_t request_idx;
+			{
+				lock_guard<mutex> guard(lock);
+				if (cancelled || next_request >= requests.size()) {
+					return;
+				}
+				request_idx = next_request++;
+			}
+			auto &request = requests[request_idx];
+			handle.Read(request.buffer, request.size, request.location);
+		}
+	}
+
+	PrefetchHandlePool &handles;
+	vector<PrefetchRequest> requests;
+
+	mutex lock;
+	std::condition_variable finished;
+	idx_t next_request;
+	idx_t active_workers;
+	bool cancelled;
+	ErrorData error;
+};
+
+// The I/O workers that read the prefetched ranges of the Parquet files of a database. Workers are started when they
+// are first needed, and are kept until the database is closed
+class PrefetchIOPool : public ObjectCacheEntry {
+public:
+	PrefetchIOPool() : shutdown(false) {
+	}
+	~PrefetchIOPool() override {
+		{
+			lock_guard<mutex> guard(lock);
+			shutdown = true;
+		}
+		work_available.notify_all();
+		for (auto &worker : workers) {
+			worker.join();
+		}
+	}
+
+	static shared_ptr<PrefetchIOPool> Get(ClientContext &context) {
+		return ObjectCache::GetObjectCache(context).GetOrCreate<PrefetchIOPool>(PrefetchIOPool::ObjectType());
+	}
+
+	// Lets up to worker_count workers read the ranges of the job
+	void Schedule(const shared_ptr<PrefetchJob> &job, idx_t worker_count) {
+#ifndef DUCKDB_NO_THREADS
+		if (worker_count == 0) {
+			return;
+		}
+		{
+			lock_guard<mutex> guard(lock);
+			while (workers.size() < worker_count) {
+				workers.emplace_back([this]() { WorkerLoop(); });
+			}
+			for (idx_t i = 0; i < worker_count; i++) {
+				jobs.push_back(job);
+			}
+		}
+		work_available.notify_all();
+#endif
+	}
+
+	static string ObjectType() {
+		return "parquet_prefetch_io_pool";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	void WorkerLoop() {
+		while (true) {
+			shared_ptr<PrefetchJob> job;
+			{
+				unique_lock<mutex> guard(lock);
+				work_available.wait(guard, [&]() { return shutdown || !jobs.empty(); });
+				if (shutdown) {
+					return;
+				}
+				job = std::move(jobs.front());
+				jobs.pop_front();
+			}
+			job->Work();
+		}
+	}
+
+	mutex lock;
+	std::condition_variable work_available;
+	deque<shared_ptr<PrefetchJob>> jobs;
+	vector<thread> workers;
+	bool shutdown;
+};
+
 // A ReadHead for prefetching data in a specific range
 struct ReadHead {
 	ReadHead(idx_t location, uint64_t size) : location(location), size(size) {};
@@ -21,6 +241,8 @@ struct ReadHead {
 	// Current info
 	AllocatedData data;
 	bool data_isset = false;
+	// The job that is reading this range in the background, if any
+	shared_ptr<PrefetchJob> pending_fetch;
 
 	idx_t GetEnd() const {
 		return size + location;
@@ -49,10 +271,16 @@ struct ReadHeadComparator {
 
 // Two-step read ahead buffer
 // 1: register all ranges that will be read, merging ranges that are consecutive
-// 2: prefetch all registered ranges
+// 2: prefetch all registered ranges, concurrently if an I/O pool is set
 struct ReadAheadBuffer {
+	// Ranges larger than this are split into multiple requests, so a single large range is read concurrently as well
+	static constexpr idx_t PREFETCH_REQUEST_SIZE = 1 << 22; // 4 MiB
+
 	ReadAheadBuffer(Allocator &allocator, FileHandle &handle) : allocator(allocator), handle(handle) {
 	}
+	~ReadAheadBuffer() {
+		JoinPending();
+	}
 
 	// The list of read heads
 	std::list<ReadHead> read_heads;
@@ -61,11 +289,19 @@ struct ReadAheadBuffer {
 
 	Allocator &allocator;
 	FileHandle &handle;
+	optional_ptr<PrefetchIOPool> io_pool;
+	optional_ptr<PrefetchHandlePool> handle_pool;
 
 	idx_t total_size = 0;
 
 	// Add a read head to the prefetching list
 	void AddReadHead(idx_t pos, uint64_t len, bool merge_buffers = true) {
+		// Ranges that were registered earlier (e.g. when reading ahead) do not have to be registered again
+		for (auto &read_head : read_heads) {
+			if (pos >= read_head.location && pos + len <= read_head.GetEnd()) {
+				return;
+			}
+		}
 		// Attempt to merge with existing
 		if (merge_buffers) {
 			ReadHead new_read_head {pos, len};
@@ -93,27 +329,104 @@ struct ReadAheadBuffer {
 		}
 	}
 
-	// Returns the relevant read head
-	ReadHead *GetReadHead(idx_t pos) {
+	// Returns the relevant read head, i.e. the one that holds all of [pos, pos + len)
+	ReadHead *GetReadHead(idx_t pos, idx_t len) {
 		for (auto &read_head : read_heads) {
-			if (pos >= read_head.location && pos < read_head.GetEnd()) {
+			if (pos >= read_head.location && pos + len <= read_head.GetEnd()) {
 				return &read_head;
 			}
 		}
 		return nullptr;
 	}
 
-	// Prefetch all read heads
-	void Prefetch() {
+	// Prefetch all read heads, if wait is false the ranges are read in the background
+	void Prefetch(bool wait = true) {
+		vector<ReadHead *> fetch_heads;
+		vector<PrefetchRequest> requests;
 		for (auto &read_head : read_heads) {
+			if (read_head.data_isset || read_head.pending_fetch) {
+				// this range was already fetched
+				continue;
+			}
 			read_head.Allocate(allocator);
 
 			if (read_head.GetEnd() > handle.GetFileSize()) {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
+			fetch_heads.push_back(&read_head);
+			for (idx_t offset = 0; offset < read_head.size; offset += PREFETCH_REQUEST_SIZE) {
+				auto size = MinValue<idx_t>(PREFETCH_REQUEST_SIZE, read_head.size - offset);
+				requests.push_back(PrefetchRequest {read_head.data.get() + offset, read_head.location + offset, size});
+			}
+		}
+		if (requests.empty()) {
+			return;
+		}
+		if (!io_pool || (wait && requests.size() == 1)) {
+			for (auto &read_head : fetch_heads) {
+				handle.Read(read_head->data.get(), read_head->size, read_head->location);
+				read_head->data_isset = true;
+			}
+			return;
+		}
+		auto job = make_shared_ptr<PrefetchJob>(*handle_pool, std::move(requests));
+		for (auto &read_head : fetch_heads) {
+			read_head->pending_fetch = job;
+		}
+		// if we wait for the ranges, this thread reads some of them as well
+		auto worker_count = MinValue<idx_t>(handle_pool->MaxWorkers(), job->RequestCount());
+		io_pool->Schedule(job, wait ? worker_count - 1 : worker_count);
+		if (wait) {
+			for (auto &read_head : fetch_heads) {
+				EnsureFetched(*read_head);
+			}
+		}
+	}
 
+	// Makes sure the data of the read head is available, reading it or waiting for a background read if required
+	void EnsureFetched(ReadHead &read_head) {
+		if (read_head.data_isset) {
+			return;
+		}
+		if (read_head.pending_fetch) {
+			read_head.pending_fetch->Wait(handle);
+			read_head.pending_fetch.reset();
+		} else {
+			read_head.Allocate(allocator);
 			handle.Read(read_head.data.get(), read_head.size, read_head.location);
-			read_head.data_isset = true;
+		}
+		read_head.data_isset = true;
+	}
+
+	// Removes all read heads outside of [start, end), read heads inside of the range are kept
+	void Retain(idx_t start, idx_t end) {
+		for (auto it = read_heads.begin(); it != read_heads.end();) {
+			if (it->location >= start && it->GetEnd() <= end) {
+				it++;
+				continue;
+			}
+			if (it->pending_fetch) {
+				// the job may also read ranges that we keep
+				it->pending_fetch->Join(handle);
+			}
+			it = read_heads.erase(it);
+		}
+		merge_set.clear();
+	}
+
+	void Clear() {
+		JoinPending();
+		read_heads.clear();
+		merge_set.clear();
+	}
+
+private:
+	// Background reads write into the buffers of the read heads, so they have to finish before we free them
+	void JoinPending() {
+		for (auto &read_head : read_heads) {
+			if (read_head.pending_fetch) {
+				read_head.pending_fetch->Cancel();
+			}
 		}
 	}
 };
@@ -123,25 +436,21 @@ public:
 	static constexpr uint64_t PREFETCH_FALLBACK_BUFFERSIZE = 1000000;
 
 	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p)
-	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(ReadAheadBuffer(allocator, handle_p)),
+	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(allocator, handle_p),
 	      prefetch_mode(prefetch_mode_p) {
 	}
 
 	uint32_t read(uint8_t *buf, uint32_t len) {
-		auto prefetch_buffer = ra_buffer.GetReadHead(location);
-		if (prefetch_buffer != nullptr && location - prefetch_buffer->location + len <= prefetch_buffer->size) {
+		auto prefetch_buffer = ra_buffer.GetReadHead(location, len);
+		if (prefetch_buffer != nullptr) {
 			D_ASSERT(location - prefetch_buffer->location + len <= prefetch_buffer->size);
 
-			if (!prefetch_buffer->data_isset) {
-				prefetch_buffer->Allocate(allocator);
-				handle.Read(prefetch_buffer->data.get(), prefetch_buffer->size, prefetch_buffer->location);
-				prefetch_buffer->data_isset = true;
-			}
+			ra_buffer.EnsureFetched(*prefetch_buffer);
 			memcpy(buf, prefetch_buffer->data.get() + location - prefetch_buffer->location, len);
 		} else {
 			if (prefetch_mode && len < PREFETCH_FALLBACK_BUFFERSIZE && len > 0) {
 				Prefetch(location, MinValue<uint64_t>(PREFETCH_FALLBACK_BUFFERSIZE, handle.GetFileSize() - location));
-				auto prefetch_buffer_fallback = ra_buffer.GetReadHead(location);
+				auto prefetch_buffer_fallback = ra_buffer.GetReadHead(location, len);
 				D_ASSERT(location - prefetch_buffer_fallback->location + len <= prefetch_buffer_fallback->size);
 				memcpy(buf, prefetch_buffer_fallback->data.get() + location - prefetch_buffer_fallback->location, len);
 			} else {
@@ -174,9 +483,30 @@ public:
 		ra_buffer.Prefetch();
 	}
 
+	// Start reading all previously registered ranges in the background, reads of these ranges wait for them to arrive
+	void PrefetchRegisteredAsync() {
+		ra_buffer.Prefetch(false);
+	}
+
 	void ClearPrefetch() {
-		ra_buffer.read_heads.clear();
-		ra_buffer.merge_set.clear();
+		ra_buffer.Clear();
+	}
+
+	// Clear all prefetched ranges, except for the ones within [start, end)
+	void ClearPrefetch(idx_t start, idx_t end) {
+		ra_buffer.Retain(start, end);
+	}
+
+	// Read the prefetched ranges concurrently on up to io_threads workers of the I/O pool
+	void EnableConcurrentPrefetch(shared_ptr<PrefetchIOPool> io_pool_p, FileSystem &fs, FileOpenFlags flags,
+	                              idx_t io_threads) {
+		if (io_threads <= 1 || !io_pool_p) {
+			return;
+		}
+		io_pool = std::move(io_pool_p);
+		handle_pool = make_uniq<PrefetchHandlePool>(fs, handle.path, flags, io_threads);
+		ra_buffer.io_pool = io_pool.get();
+		ra_buffer.handle_pool = handle_pool.get();
 	}
 
 	void SetLocation(idx_t location_p) {
@@ -196,6 +526,10 @@ private:
 
 	Allocator &allocator;
 
+	// The workers and handles for reading the prefetched ranges concurrently, these have to outlive the background
+	// reads of ra_buffer
+	shared_ptr<PrefetchIOPool> io_pool;
+	unique_ptr<PrefetchHandlePool> handle_pool;
 	// Multi-buffer prefetch
 	ReadAheadBuffer ra_buffer;
 
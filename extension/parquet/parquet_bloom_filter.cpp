@@ -0,0 +1,59 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+
+#include <cmath>
+
+namespace duckdb {
+
+//! The salts used to select the bit within each of the eight words of a block
+static constexpr const uint32_t PARQUET_BLOOM_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_entries, double false_positive_ratio) {
+	D_ASSERT(false_positive_ratio > 0 && false_positive_ratio < 1);
+	// the optimal number of bits for an SBBF, see the Parquet bloom filter specification
+	auto num_bits =
+	    -8.0 * double(MaxValue<idx_t>(num_entries, 1)) / std::log(1 - std::pow(false_positive_ratio, 0.125));
+	auto num_bytes = NextPowerOfTwo(idx_t(std::ceil(num_bits / 8)));
+	num_bytes = MinValue<idx_t>(MaxValue<idx_t>(num_bytes, BLOCK_SIZE), MAX_BLOOM_FILTER_SIZE);
+	blocks.resize(num_bytes / sizeof(uint32_t), 0);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(const_data_ptr_t data, idx_t size) {
+	if (size == 0 || size % BLOCK_SIZE != 0 || size > MAX_BLOOM_FILTER_SIZE) {
+		throw InvalidInputException("Invalid Parquet bloom filter size %llu", size);
+	}
+	blocks.resize(size / sizeof(uint32_t));
+	memcpy(blocks.data(), data, size);
+}
+
+void ParquetBloomFilter::FilterInsert(uint64_t hash) {
+	// the upper 32 bits select the block, the lower 32 bits select the bits within the block
+	auto num_blocks = blocks.size() / (BLOCK_SIZE / sizeof(uint32_t));
+	auto block_idx = ((hash >> 32) * num_blocks) >> 32;
+	auto key = static_cast<uint32_t>(hash);
+	auto block = blocks.data() + block_idx * (BLOCK_SIZE / sizeof(uint32_t));
+	for (idx_t i = 0; i < 8; i++) {
+		block[i] |= uint32_t(1) << ((key * PARQUET_BLOOM_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	auto num_blocks = blocks.size() / (BLOCK_SIZE / sizeof(uint32_t));
+	auto block_idx = ((hash >> 32) * num_blocks) >> 32;
+	auto key = static_cast<uint32_t>(hash);
+	auto block = blocks.data() + block_idx * (BLOCK_SIZE / sizeof(uint32_t));
+	for (idx_t i = 0; i < 8; i++) {
+		if (!(block[i] & (uint32_t(1) << ((key * PARQUET_BLOOM_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+} // namespace duckdb
@@ -162,6 +162,13 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+
+	//! Whether or not to write the page index (ColumnIndex/OffsetIndex)
+	bool write_page_index = false;
+	//! The (top-level) columns for which we write split block bloom filters
+	vector<string> bloom_filter_columns;
+	//! Which encodings we may use: V2 chooses between the delta and byte stream split encodings per column chunk
+	ParquetVersion parquet_version = ParquetVersion::V1;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -365,6 +372,7 @@ public:
 		table_function.projection_pushdown = true;
 		table_function.filter_pushdown = true;
 		table_function.filter_prune = true;
+		table_function.global_initialization = TableFunctionInitialization::INITIALIZE_ON_EXECUTE;
 		table_function.pushdown_complex_filter = ParquetComplexFilterPushdown;
 
 		MultiFileReader::AddParameters(table_function);
@@ -589,6 +597,11 @@ public:
 		if (gstate.CanRemoveColumns()) {
 			result->all_columns.Initialize(context.client, gstate.scanned_types);
 		}
+		// with fewer row groups than threads, the threads that have no row group to scan decode columns instead
+		auto &scheduler = TaskScheduler::GetScheduler(context.client);
+		if (gstate.max_threads < NumericCast<idx_t>(scheduler.NumberOfThreads())) {
+			result->scan_state.decode_scheduler = &scheduler;
+		}
 		if (!ParquetParallelStateNext(context.client, bind_data, *result, gstate)) {
 			return nullptr;
 		}
@@ -793,11 +806,17 @@ public:
 				if (parallel_state.row_group_index < current_reader_data.reader->NumRowGroups()) {
 					// The current reader has rowgroups left to be scanned
 					scan_data.reader = current_reader_data.reader;
-					vector<idx_t> group_indexes {parallel_state.row_group_index};
+					vector<idx_t> group_indexes {parallel_state.row_group_index++};
+					// a reader that reads ahead fetches the next row group while decoding this one, so we hand out
+					// pairs of row groups as long as there are enough left to keep the other threads busy
+					auto remaining_groups = scan_data.reader->NumRowGroups() - parallel_state.row_group_index;
+					auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+					if (remaining_groups > thread_count && scan_data.reader->ReadsAhead()) {
+						group_indexes.push_back(parallel_state.row_group_index++);
+					}
 					scan_data.reader->InitializeScan(scan_data.scan_state, group_indexes);
 					scan_data.batch_index = parallel_state.batch_index++;
 					scan_data.file_index = parallel_state.file_index;
-					parallel_state.row_group_index++;
 					return true;
 				} else {
 					// Close current file
@@ -1057,6 +1076,41 @@ static void GetFieldIDs(const Value &field_ids_value, ChildFieldIDs &field_ids,
 	}
 }
 
+static void GetBloomFilterColumns(const Value &value, vector<string> &result, const vector<string> &names,
+                                  const vector<LogicalType> &sql_types) {
+	// the columns are either given as a list or as a comma-separated string
+	vector<string> column_names;
+	if (value.type().id() == LogicalTypeId::LIST) {
+		for (auto &child : ListValue::GetChildren(value)) {
+			column_names.push_back(child.ToString());
+		}
+	} else if (value.type().id() == LogicalTypeId::VARCHAR) {
+		for (auto &column_name : StringUtil::Split(StringValue::Get(value), ',')) {
+			StringUtil::Trim(column_name);
+			column_names.push_back(column_name);
+		}
+	} else {
+		throw BinderException("Expected BLOOM_FILTER_COLUMNS argument to be a list of column names");
+	}
+	for (auto &column_name : column_names) {
+		idx_t col_idx;
+		for (col_idx = 0; col_idx < names.size(); col_idx++) {
+			if (StringUtil::CIEquals(names[col_idx], column_name)) {
+				break;
+			}
+		}
+		if (col_idx == names.size()) {
+			throw BinderException("Column \"%s\" in BLOOM_FILTER_COLUMNS does not exist", column_name);
+		}
+		auto &type = sql_types[col_idx];
+		if (type.IsNested() || type.id() == LogicalTypeId::BOOLEAN) {
+			throw BinderException("Column \"%s\" with type \"%s\" does not support bloom filters", names[col_idx],
+			                      type.ToString());
+		}
+		result.push_back(names[col_idx]);
+	}
+}
+
 unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBindInput &input,
                                           const vector<string> &names, const vector<LogicalType> &sql_types) {
 	D_ASSERT(names.size() == sql_types.size());
@@ -1144,10 +1198,27 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			bind_data->dictionary_compression_ratio_threshold = val;
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "write_page_index") {
+			bind_data->write_page_index = GetBooleanArgument(option);
+		} else if (loption == "bloom_filter_columns") {
+			GetBloomFilterColumns(option.second[0], bind_data->bloom_filter_columns, names, sql_types);
+		} else if (loption == "parquet_version") {
+			const auto roption = StringUtil::Upper(option.second[0].ToString());
+			if (roption == "V1") {
+				bind_data->parquet_version = ParquetVersion::V1;
+			} else if (roption == "V2") {
+				bind_data->parquet_version = ParquetVersion::V2;
+			} else {
+				throw BinderException("Expected parquet_version 'V1' or 'V2'");
+			}
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (bind_data->encryption_config && (bind_data->write_page_index || !bind_data->bloom_filter_columns.empty())) {
+		throw BinderException(
+		    "WRITE_PAGE_INDEX and BLOOM_FILTER_COLUMNS are not supported for encrypted Parquet files");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1172,7 +1243,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	global_state->writer = make_uniq<ParquetWriter>(
 	    fs, file_path, parquet_bind.sql_types, parquet_bind.column_names, parquet_bind.codec,
 	    parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata, parquet_bind.encryption_config,
-	    parquet_bind.dictionary_compression_ratio_threshold, parquet_bind.compression_level);
+	    parquet_bind.dictionary_compression_ratio_threshold, parquet_bind.compression_level,
+	    parquet_bind.write_page_index, parquet_bind.bloom_filter_columns, parquet_bind.parquet_version);
 	return std::move(global_state);
 }
 
@@ -1279,6 +1351,29 @@ EnumUtil::FromString<duckdb_parquet::format::CompressionCodec::type>(const char
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template <>
+const char *EnumUtil::ToChars<ParquetVersion>(ParquetVersion value) {
+	switch (value) {
+	case ParquetVersion::V1:
+		return "V1";
+	case ParquetVersion::V2:
+		return "V2";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", uint8_t(value)));
+	}
+}
+
+template <>
+ParquetVersion EnumUtil::FromString<ParquetVersion>(const char *value) {
+	if (StringUtil::Equals(value, "V1")) {
+		return ParquetVersion::V1;
+	}
+	if (StringUtil::Equals(value, "V2")) {
+		return ParquetVersion::V2;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bind_data_p,
                                  const CopyFunction &function) {
 	auto &bind_data = bind_data_p.Cast<ParquetWriteBindData>();
@@ -1294,6 +1389,10 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WriteProperty(108, "dictionary_compression_ratio_threshold",
 	                         bind_data.dictionary_compression_ratio_threshold);
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
+	serializer.WritePropertyWithDefault<bool>(110, "write_page_index", bind_data.write_page_index, false);
+	serializer.WritePropertyWithDefault<vector<string>>(111, "bloom_filter_columns", bind_data.bloom_filter_columns);
+	serializer.WritePropertyWithDefault<ParquetVersion>(112, "parquet_version", bind_data.parquet_version,
+	                                                    ParquetVersion::V1);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1310,6 +1409,10 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	deserializer.ReadPropertyWithDefault<double>(108, "dictionary_compression_ratio_threshold",
 	                                             data->dictionary_compression_ratio_threshold, 1.0);
 	deserializer.ReadPropertyWithDefault<optional_idx>(109, "compression_level", data->compression_level);
+	deserializer.ReadPropertyWithDefault<bool>(110, "write_page_index", data->write_page_index, false);
+	deserializer.ReadPropertyWithDefault<vector<string>>(111, "bloom_filter_columns", data->bloom_filter_columns);
+	deserializer.ReadPropertyWithDefault<ParquetVersion>(112, "parquet_version", data->parquet_version,
+	                                                     ParquetVersion::V1);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -1417,6 +1520,10 @@ void ParquetExtension::Load(DuckDB &db) {
 	ParquetFileMetadataFunction file_meta_fun;
 	ExtensionUtil::RegisterFunction(db_instance, MultiFileReader::CreateFunctionSet(file_meta_fun));
 
+	// parquet_bloom_probe
+	ParquetBloomProbeFunction bloom_probe_fun;
+	ExtensionUtil::RegisterFunction(db_instance, MultiFileReader::CreateFunctionSet(bloom_probe_fun));
+
 	CopyFunction function("parquet");
 	function.copy_to_bind = ParquetWriteBind;
 	function.copy_to_initialize_global = ParquetWriteInitializeGlobal;
@@ -1447,6 +1554,14 @@ void ParquetExtension::Load(DuckDB &db) {
 	config.replacement_scans.emplace_back(ParquetScanReplacement);
 	config.AddExtensionOption("binary_as_string", "In Parquet files, interpret binary data as a string.",
 	                          LogicalType::BOOLEAN);
+	config.AddExtensionOption("parquet_prefetch_io_threads",
+	                          "The amount of background threads that concurrently read the byte ranges prefetched from "
+	                          "remote Parquet files, 1 reads them synchronously",
+	                          LogicalType::UBIGINT,
+	                          Value::UBIGINT(ParquetReaderPrefetchConfig::DEFAULT_PREFETCH_IO_THREADS));
+	config.AddExtensionOption("prefetch_all_parquet_files",
+	                          "Use the prefetching mechanism for all Parquet files, including local files",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
 }
 
 std::string ParquetExtension::Name() {
@@ -1,5 +1,6 @@
 #include "parquet_metadata.hpp"
 
+#include "parquet_bloom_filter.hpp"
 #include "parquet_statistics.hpp"
 
 #include <sstream>
@@ -19,7 +20,18 @@ struct ParquetMetaDataBindData : public TableFunctionData {
 	unique_ptr<MultiFileReader> multi_file_reader;
 };
 
-enum class ParquetMetadataOperatorType : uint8_t { META_DATA, SCHEMA, KEY_VALUE_META_DATA, FILE_META_DATA };
+struct ParquetBloomProbeBindData : public ParquetMetaDataBindData {
+	string probe_column_name;
+	Value probe_constant;
+};
+
+enum class ParquetMetadataOperatorType : uint8_t {
+	META_DATA,
+	SCHEMA,
+	KEY_VALUE_META_DATA,
+	FILE_META_DATA,
+	BLOOM_PROBE
+};
 
 struct ParquetMetaDataOperatorData : public GlobalTableFunctionState {
 	explicit ParquetMetaDataOperatorData(ClientContext &context, const vector<LogicalType> &types)
@@ -37,11 +49,14 @@ public:
 	static void BindSchema(vector<LogicalType> &return_types, vector<string> &names);
 	static void BindKeyValueMetaData(vector<LogicalType> &return_types, vector<string> &names);
 	static void BindFileMetaData(vector<LogicalType> &return_types, vector<string> &names);
+	static void BindBloomProbe(vector<LogicalType> &return_types, vector<string> &names);
 
 	void LoadRowGroupMetadata(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadSchemaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadKeyValueMetaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadFileMetaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
+	void LoadBloomProbe(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path,
+	                    const string &column_name, const Value &probe);
 };
 
 template <class T>
@@ -164,6 +179,18 @@ void ParquetMetaDataOperatorData::BindMetaData(vector<LogicalType> &return_types
 
 	names.emplace_back("key_value_metadata");
 	return_types.emplace_back(LogicalType::MAP(LogicalType::BLOB, LogicalType::BLOB));
+
+	names.emplace_back("bloom_filter_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bloom_filter_length");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("column_index_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("offset_index_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
 }
 
 Value ConvertParquetStats(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
@@ -298,6 +325,22 @@ void ParquetMetaDataOperatorData::LoadRowGroupMetadata(ClientContext &context, c
 			    23, count,
 			    Value::MAP(LogicalType::BLOB, LogicalType::BLOB, std::move(map_keys), std::move(map_values)));
 
+			// bloom_filter_offset, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    24, count, ParquetElementBigint(col_meta.bloom_filter_offset, col_meta.__isset.bloom_filter_offset));
+
+			// bloom_filter_length, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    25, count, ParquetElementBigint(col_meta.bloom_filter_length, col_meta.__isset.bloom_filter_length));
+
+			// column_index_offset, LogicalType::BIGINT
+			current_chunk.SetValue(26, count,
+			                       ParquetElementBigint(column.column_index_offset, column.__isset.column_index_offset));
+
+			// offset_index_offset, LogicalType::BIGINT
+			current_chunk.SetValue(27, count,
+			                       ParquetElementBigint(column.offset_index_offset, column.__isset.offset_index_offset));
+
 			count++;
 			if (count >= STANDARD_VECTOR_SIZE) {
 				current_chunk.SetCardinality(count);
@@ -560,6 +603,184 @@ void ParquetMetaDataOperatorData::LoadFileMetaData(ClientContext &context, const
 	collection.InitializeScan(scan_state);
 }
 
+//===--------------------------------------------------------------------===//
+// Bloom Probe
+//===--------------------------------------------------------------------===//
+void ParquetMetaDataOperatorData::BindBloomProbe(vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("file_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("row_group_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bloom_filter_excludes");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+}
+
+//! Returns the value of an integral (or date or decimal) value, extended to 64 bits
+static int64_t GetIntegralValue(const Value &value) {
+	switch (value.type().InternalType()) {
+	case PhysicalType::INT8:
+		return value.GetValueUnsafe<int8_t>();
+	case PhysicalType::INT16:
+		return value.GetValueUnsafe<int16_t>();
+	case PhysicalType::INT32:
+		return value.GetValueUnsafe<int32_t>();
+	case PhysicalType::INT64:
+		return value.GetValueUnsafe<int64_t>();
+	case PhysicalType::UINT8:
+		return value.GetValueUnsafe<uint8_t>();
+	case PhysicalType::UINT16:
+		return value.GetValueUnsafe<uint16_t>();
+	case PhysicalType::UINT32:
+		return value.GetValueUnsafe<uint32_t>();
+	case PhysicalType::UINT64:
+		return static_cast<int64_t>(value.GetValueUnsafe<uint64_t>());
+	default:
+		throw NotImplementedException("Probing the bloom filter of a column of type %s is not supported",
+		                              value.type().ToString());
+	}
+}
+
+//! Hashes the plain encoding of the probe value in the same way as the values of the column
+static uint64_t HashBloomProbe(const Value &probe, const duckdb_parquet::format::SchemaElement &schema_element) {
+	auto type = ParquetReader::DeriveLogicalType(schema_element, true);
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+		break;
+	default:
+		// e.g. timestamps, of which the unit in the file may differ from the unit in DuckDB
+		throw NotImplementedException("Probing the bloom filter of a column of type %s is not supported",
+		                              type.ToString());
+	}
+	auto value = probe.DefaultCastAs(type);
+	switch (schema_element.type) {
+	case duckdb_parquet::format::Type::INT32:
+		return ParquetBloomFilter::Hash<int32_t>(static_cast<int32_t>(GetIntegralValue(value)));
+	case duckdb_parquet::format::Type::INT64:
+		return ParquetBloomFilter::Hash<int64_t>(GetIntegralValue(value));
+	case duckdb_parquet::format::Type::FLOAT:
+		return ParquetBloomFilter::Hash<float>(FloatValue::Get(value));
+	case duckdb_parquet::format::Type::DOUBLE:
+		return ParquetBloomFilter::Hash<double>(DoubleValue::Get(value));
+	case duckdb_parquet::format::Type::BYTE_ARRAY: {
+		auto &str = StringValue::Get(value);
+		return ParquetBloomFilter::Hash(const_data_ptr_cast(str.c_str()), str.size());
+	}
+	default:
+		throw NotImplementedException("Probing the bloom filter of a column of type %s is not supported",
+		                              type.ToString());
+	}
+}
+
+//! Reads the bloom filter of a column chunk, the header is followed by the bitset
+static unique_ptr<ParquetBloomFilter> ReadBloomFilter(ParquetReader &reader,
+                                                      const duckdb_parquet::format::ColumnMetaData &col_meta) {
+	auto transport = std::make_shared<ThriftFileTransport>(reader.allocator, reader.GetHandle(), false);
+	duckdb_apache::thrift::protocol::TCompactProtocolT<ThriftFileTransport> protocol(transport);
+	transport->SetLocation(NumericCast<idx_t>(col_meta.bloom_filter_offset));
+
+	// the BloomFilterHeader is not part of our generated thrift code, we only need the size of the bitset
+	int32_t num_bytes = -1;
+	string name;
+	duckdb_apache::thrift::protocol::TType field_type;
+	int16_t field_id;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		if (field_id == 1 && field_type == duckdb_apache::thrift::protocol::T_I32) {
+			protocol.readI32(num_bytes);
+		} else {
+			protocol.skip(field_type);
+		}
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+	if (num_bytes <= 0) {
+		throw InvalidInputException("Failed to read the bloom filter header of Parquet file \"%s\"",
+		                            reader.GetFileName());
+	}
+
+	AllocatedData data = reader.allocator.Allocate(NumericCast<idx_t>(num_bytes));
+	transport->read(data.get(), NumericCast<uint32_t>(num_bytes));
+	return make_uniq<ParquetBloomFilter>(data.get(), data.GetSize());
+}
+
+void ParquetMetaDataOperatorData::LoadBloomProbe(ClientContext &context, const vector<LogicalType> &return_types,
+                                                 const string &file_path, const string &column_name,
+                                                 const Value &probe) {
+	collection.Reset();
+	ParquetOptions parquet_options(context);
+	auto reader = make_uniq<ParquetReader>(context, file_path, parquet_options);
+	auto meta_data = reader->GetFileMetadata();
+
+	// bloom filters are only written for top-level columns, find the column chunk of the probed column
+	optional_idx probe_column_idx;
+	optional_idx probe_schema_idx;
+	idx_t column_idx = 0;
+	for (idx_t schema_idx = 1; schema_idx < meta_data->schema.size(); schema_idx++) {
+		auto &schema_element = meta_data->schema[schema_idx];
+		if (schema_element.num_children > 0) {
+			continue;
+		}
+		if (schema_element.name == column_name) {
+			probe_column_idx = column_idx;
+			probe_schema_idx = schema_idx;
+			break;
+		}
+		column_idx++;
+	}
+	if (!probe_column_idx.IsValid()) {
+		throw InvalidInputException("Column \"%s\" not found in Parquet file \"%s\"", column_name, file_path);
+	}
+	auto hash = HashBloomProbe(probe, meta_data->schema[probe_schema_idx.GetIndex()]);
+
+	DataChunk current_chunk;
+	current_chunk.Initialize(context, return_types);
+	idx_t count = 0;
+	for (idx_t row_group_idx = 0; row_group_idx < meta_data->row_groups.size(); row_group_idx++) {
+		auto &row_group = meta_data->row_groups[row_group_idx];
+		auto &col_meta = row_group.columns[probe_column_idx.GetIndex()].meta_data;
+
+		bool excludes = false;
+		if (col_meta.__isset.bloom_filter_offset) {
+			auto bloom_filter = ReadBloomFilter(*reader, col_meta);
+			excludes = !bloom_filter->FilterCheck(hash);
+		}
+
+		current_chunk.SetValue(0, count, Value(file_path));
+		current_chunk.SetValue(1, count, Value::BIGINT(NumericCast<int64_t>(row_group_idx)));
+		current_chunk.SetValue(2, count, Value::BOOLEAN(excludes));
+
+		count++;
+		if (count >= STANDARD_VECTOR_SIZE) {
+			current_chunk.SetCardinality(count);
+			collection.Append(current_chunk);
+			count = 0;
+			current_chunk.Reset();
+		}
+	}
+	current_chunk.SetCardinality(count);
+	collection.Append(current_chunk);
+	collection.InitializeScan(scan_state);
+}
+
 //===--------------------------------------------------------------------===//
 // Bind
 //===--------------------------------------------------------------------===//
@@ -579,11 +800,27 @@ unique_ptr<FunctionData> ParquetMetaDataBind(ClientContext &context, TableFuncti
 	case ParquetMetadataOperatorType::FILE_META_DATA:
 		ParquetMetaDataOperatorData::BindFileMetaData(return_types, names);
 		break;
+	case ParquetMetadataOperatorType::BLOOM_PROBE:
+		ParquetMetaDataOperatorData::BindBloomProbe(return_types, names);
+		break;
 	default:
 		throw InternalException("Unsupported ParquetMetadataOperatorType");
 	}
 
-	auto result = make_uniq<ParquetMetaDataBindData>();
+	unique_ptr<ParquetMetaDataBindData> result;
+	if (TYPE == ParquetMetadataOperatorType::BLOOM_PROBE) {
+		auto probe_bind_data = make_uniq<ParquetBloomProbeBindData>();
+		auto &column_name = input.inputs[1];
+		auto &probe = input.inputs[2];
+		if (column_name.IsNull() || probe.IsNull()) {
+			throw BinderException("parquet_bloom_probe requires a column name and a non-NULL value to probe");
+		}
+		probe_bind_data->probe_column_name = StringValue::Get(column_name.DefaultCastAs(LogicalType::VARCHAR));
+		probe_bind_data->probe_constant = probe;
+		result = std::move(probe_bind_data);
+	} else {
+		result = make_uniq<ParquetMetaDataBindData>();
+	}
 	result->return_types = return_types;
 	result->multi_file_reader = MultiFileReader::Create(input.table_function);
 	result->file_list = result->multi_file_reader->CreateFileList(context, input.inputs[0]);
@@ -614,6 +851,12 @@ unique_ptr<GlobalTableFunctionState> ParquetMetaDataInit(ClientContext &context,
 	case ParquetMetadataOperatorType::FILE_META_DATA:
 		result->LoadFileMetaData(context, bind_data.return_types, bind_data.file_list->GetFirstFile());
 		break;
+	case ParquetMetadataOperatorType::BLOOM_PROBE: {
+		auto &probe_bind_data = input.bind_data->Cast<ParquetBloomProbeBindData>();
+		result->LoadBloomProbe(context, bind_data.return_types, bind_data.file_list->GetFirstFile(),
+		                       probe_bind_data.probe_column_name, probe_bind_data.probe_constant);
+		break;
+	}
 	default:
 		throw InternalException("Unsupported ParquetMetadataOperatorType");
 	}
@@ -647,6 +890,12 @@ void ParquetMetaDataImplementation(ClientContext &context, TableFunctionInput &d
 			case ParquetMetadataOperatorType::FILE_META_DATA:
 				data.LoadFileMetaData(context, bind_data.return_types, data.current_file);
 				break;
+			case ParquetMetadataOperatorType::BLOOM_PROBE: {
+				auto &probe_bind_data = data_p.bind_data->Cast<ParquetBloomProbeBindData>();
+				data.LoadBloomProbe(context, bind_data.return_types, data.current_file,
+				                    probe_bind_data.probe_column_name, probe_bind_data.probe_constant);
+				break;
+			}
 			default:
 				throw InternalException("Unsupported ParquetMetadataOperatorType");
 			}
@@ -686,4 +935,11 @@ ParquetFileMetadataFunction::ParquetFileMetadataFunction()
                     ParquetMetaDataInit<ParquetMetadataOperatorType::FILE_META_DATA>) {
 }
 
+ParquetBloomProbeFunction::ParquetBloomProbeFunction()
+    : TableFunction("parquet_bloom_probe", {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::ANY},
+                    ParquetMetaDataImplementation<ParquetMetadataOperatorType::BLOOM_PROBE>,
+                    ParquetMetaDataBind<ParquetMetadataOperatorType::BLOOM_PROBE>,
+                    ParquetMetaDataInit<ParquetMetadataOperatorType::BLOOM_PROBE>) {
+}
+
 } // namespace duckdb
@@ -23,6 +23,7 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/date.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
@@ -463,6 +464,14 @@ ParquetOptions::ParquetOptions(ClientContext &context) {
 	if (context.TryGetCurrentSetting("binary_as_string", binary_as_string_val)) {
 		binary_as_string = binary_as_string_val.GetValue<bool>();
 	}
+	Value prefetch_io_threads_val;
+	if (context.TryGetCurrentSetting("parquet_prefetch_io_threads", prefetch_io_threads_val)) {
+		prefetch_io_threads = prefetch_io_threads_val.GetValue<uint64_t>();
+	}
+	Value prefetch_all_files_val;
+	if (context.TryGetCurrentSetting("prefetch_all_parquet_files", prefetch_all_files_val)) {
+		prefetch_all_files = prefetch_all_files_val.GetValue<bool>();
+	}
 }
 
 ParquetColumnDefinition ParquetColumnDefinition::FromSchemaValue(ClientContext &context, const Value &column_value) {
@@ -488,6 +497,7 @@ ParquetReader::ParquetReader(ClientContext &context_p, string file_name_p, Parqu
     : fs(FileSystem::GetFileSystem(context_p)), allocator(BufferAllocator::Get(context_p)),
       parquet_options(std::move(parquet_options_p)) {
 	file_name = std::move(file_name_p);
+	prefetch_io_pool = PrefetchIOPool::Get(context_p);
 	file_handle = fs.OpenFile(file_name, FileFlags::FILE_FLAGS_READ);
 	if (!file_handle->CanSeek()) {
 		throw NotImplementedException(
@@ -514,6 +524,7 @@ ParquetReader::ParquetReader(ClientContext &context_p, ParquetOptions parquet_op
                              shared_ptr<ParquetFileMetadataCache> metadata_p)
     : fs(FileSystem::GetFileSystem(context_p)), allocator(BufferAllocator::Get(context_p)),
       metadata(std::move(metadata_p)), parquet_options(std::move(parquet_options_p)) {
+	prefetch_io_pool = PrefetchIOPool::Get(context_p);
 	InitializeSchema();
 }
 
@@ -602,8 +613,7 @@ uint64_t ParquetReader::GetGroupCompressedSize(ParquetReaderScanState &state) {
 	return total_compressed_size ? total_compressed_size : calc_compressed_size;
 }
 
-uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
-	auto &group = GetGroup(state);
+static uint64_t GetRowGroupSpan(const ParquetRowGroup &group) {
 	idx_t min_offset = NumericLimits<idx_t>::Maximum();
 	idx_t max_offset = NumericLimits<idx_t>::Minimum();
 
@@ -625,21 +635,99 @@ uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
 	return max_offset - min_offset;
 }
 
-idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
-	auto &group = GetGroup(state);
+static idx_t GetColumnChunkOffset(const ColumnChunk &column_chunk) {
 	idx_t min_offset = NumericLimits<idx_t>::Maximum();
+	if (column_chunk.meta_data.__isset.dictionary_page_offset) {
+		min_offset = MinValue<idx_t>(min_offset, column_chunk.meta_data.dictionary_page_offset);
+	}
+	if (column_chunk.meta_data.__isset.index_page_offset) {
+		min_offset = MinValue<idx_t>(min_offset, column_chunk.meta_data.index_page_offset);
+	}
+	return MinValue<idx_t>(min_offset, column_chunk.meta_data.data_page_offset);
+}
 
+static idx_t GetRowGroupOffset(const ParquetRowGroup &group) {
+	idx_t min_offset = NumericLimits<idx_t>::Maximum();
 	for (auto &column_chunk : group.columns) {
-		if (column_chunk.meta_data.__isset.dictionary_page_offset) {
-			min_offset = MinValue<idx_t>(min_offset, column_chunk.meta_data.dictionary_page_offset);
+		min_offset = MinValue<idx_t>(min_offset, GetColumnChunkOffset(column_chunk));
+	}
+	return min_offset;
+}
+
+uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
+	return GetRowGroupSpan(GetGroup(state));
+}
+
+idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
+	return GetRowGroupOffset(GetGroup(state));
+}
+
+// Skips over the schema element at schema_idx and its children, counting the leaf columns (i.e. column chunks)
+static void SkipSchemaElement(const vector<SchemaElement> &schema, idx_t &schema_idx, idx_t &leaf_count) {
+	auto &s_ele = schema[schema_idx++];
+	if (!s_ele.__isset.num_children || s_ele.num_children <= 0) {
+		leaf_count++;
+		return;
+	}
+	for (idx_t child_idx = 0; child_idx < (idx_t)s_ele.num_children; child_idx++) {
+		SkipSchemaElement(schema, schema_idx, leaf_count);
+	}
+}
+
+// Returns the column chunks [first, last) that store the top-level column at file_col_idx
+static pair<idx_t, idx_t> GetColumnChunkRange(const vector<SchemaElement> &schema, idx_t file_col_idx) {
+	idx_t schema_idx = 1;
+	idx_t leaf_count = 0;
+	for (idx_t child_idx = 0; child_idx < (idx_t)schema[0].num_children; child_idx++) {
+		auto first_leaf = leaf_count;
+		SkipSchemaElement(schema, schema_idx, leaf_count);
+		if (child_idx == file_col_idx) {
+			return make_pair(first_leaf, leaf_count);
 		}
-		if (column_chunk.meta_data.__isset.index_page_offset) {
-			min_offset = MinValue<idx_t>(min_offset, column_chunk.meta_data.index_page_offset);
+	}
+	// generated columns (e.g. the file_row_number) are not stored in the file
+	return make_pair<idx_t, idx_t>(0, 0);
+}
+
+void ParquetReader::PrefetchNextGroup(ParquetReaderScanState &state) {
+	auto next_group = NumericCast<idx_t>(state.current_group) + 1;
+	if (next_group >= state.group_idx_list.size()) {
+		return;
+	}
+	auto file_meta_data = GetFileMetadata();
+	auto &group = file_meta_data->row_groups[state.group_idx_list[next_group]];
+	if (group.num_rows == 0 || group.columns.empty()) {
+		return;
+	}
+
+	// we use the same strategy as for the current row group: fetch the whole row group if we read (almost) all of it
+	vector<pair<idx_t, uint64_t>> ranges;
+	uint64_t to_scan_compressed_bytes = 0;
+	for (auto &file_col_idx : reader_data.column_ids) {
+		auto chunk_range = GetColumnChunkRange(file_meta_data->schema, file_col_idx);
+		for (idx_t chunk_idx = chunk_range.first; chunk_idx < chunk_range.second; chunk_idx++) {
+			auto &column_chunk = group.columns[chunk_idx];
+			uint64_t size = column_chunk.meta_data.total_compressed_size;
+			ranges.emplace_back(GetColumnChunkOffset(column_chunk), size);
+			to_scan_compressed_bytes += size;
 		}
-		min_offset = MinValue<idx_t>(min_offset, column_chunk.meta_data.data_page_offset);
+	}
+	auto total_row_group_span = GetRowGroupSpan(group);
+	if (ranges.empty() || to_scan_compressed_bytes > total_row_group_span) {
+		return;
 	}
 
-	return min_offset;
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	double scan_percentage = (double)(to_scan_compressed_bytes) / total_row_group_span;
+	if (scan_percentage > ParquetReaderPrefetchConfig::WHOLE_GROUP_PREFETCH_MINIMUM_SCAN) {
+		trans.RegisterPrefetch(GetRowGroupOffset(group), total_row_group_span, false);
+	} else {
+		for (auto &range : ranges) {
+			trans.RegisterPrefetch(range.first, range.second);
+		}
+	}
+	trans.FinalizeRegistration();
+	trans.PrefetchRegisteredAsync();
 }
 
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
@@ -672,6 +760,151 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+// Whether or not a filter never passes for NULL values
+static bool FilterRejectsNulls(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (FilterRejectsNulls(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!FilterRejectsNulls(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+void ParquetReader::PreparePageSkipping(ParquetReaderScanState &state) {
+	state.skipped_rows.clear();
+	state.skipped_rows_idx = 0;
+
+	auto &group = GetGroup(state);
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+	if (!reader_data.filters || state.group_offset == group_rows || parquet_options.encryption_config) {
+		// no filters, the row group is skipped entirely, or the page index is encrypted
+		return;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	if (state.prefetch_mode) {
+		// fetch the page index of the row group up front - the index structures of the columns are stored next to
+		// each other, so this is merged into a few reads
+		bool has_page_index = false;
+		for (auto &column_chunk : group.columns) {
+			if (column_chunk.__isset.column_index_offset && column_chunk.__isset.offset_index_offset) {
+				trans.RegisterPrefetch(NumericCast<idx_t>(column_chunk.column_index_offset),
+				                       NumericCast<idx_t>(column_chunk.column_index_length));
+				trans.RegisterPrefetch(NumericCast<idx_t>(column_chunk.offset_index_offset),
+				                       NumericCast<idx_t>(column_chunk.offset_index_length));
+				has_page_index = true;
+			}
+		}
+		if (!has_page_index) {
+			return;
+		}
+		trans.FinalizeRegistration();
+		trans.PrefetchRegistered();
+	}
+
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	vector<ParquetRowRange> skipped_rows;
+	for (auto &filter_col : reader_data.filters->filters) {
+		auto &filter_entry = reader_data.filter_map[filter_col.first];
+		if (filter_entry.is_constant) {
+			continue;
+		}
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[filter_entry.index]);
+		if (column_reader->FileIdx() >= group.columns.size() || column_reader->MaxRepeat() > 0 ||
+		    column_reader->Type().id() == LogicalTypeId::STRUCT) {
+			continue;
+		}
+		auto &column_chunk = group.columns[column_reader->FileIdx()];
+		if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.offset_index_offset) {
+			continue;
+		}
+		if (!column_reader->Stats(state.group_idx_list[state.current_group], group.columns)) {
+			// we cannot convert the statistics of this column
+			continue;
+		}
+		ColumnIndex column_index;
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.column_index_offset));
+		Read(column_index, *state.thrift_file_proto);
+		OffsetIndex offset_index;
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+		Read(offset_index, *state.thrift_file_proto);
+
+		auto &pages = offset_index.page_locations;
+		if (pages.empty() || column_index.null_pages.size() != pages.size()) {
+			continue;
+		}
+		auto &filter = *filter_col.second;
+		for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+			bool skip_page;
+			if (column_index.null_pages[page_idx]) {
+				skip_page = FilterRejectsNulls(filter);
+			} else {
+				auto page_stats =
+				    ParquetStatisticsUtils::TransformPageStatistics(*column_reader, column_index, page_idx);
+				skip_page =
+				    page_stats && filter.CheckStatistics(*page_stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			}
+			if (!skip_page) {
+				continue;
+			}
+			auto page_start = NumericCast<idx_t>(pages[page_idx].first_row_index);
+			auto page_end =
+			    page_idx + 1 < pages.size() ? NumericCast<idx_t>(pages[page_idx + 1].first_row_index) : group_rows;
+			if (page_start < page_end && page_end <= group_rows) {
+				skipped_rows.push_back(ParquetRowRange {page_start, page_end});
+			}
+		}
+	}
+	if (skipped_rows.empty()) {
+		return;
+	}
+
+	// the rows are skipped when any of the filters cannot match - merge the ranges of all columns
+	std::sort(skipped_rows.begin(), skipped_rows.end(),
+	          [](const ParquetRowRange &a, const ParquetRowRange &b) { return a.start < b.start; });
+	vector<ParquetRowRange> merged_rows;
+	for (auto &range : skipped_rows) {
+		if (!merged_rows.empty() && range.start <= merged_rows.back().end) {
+			merged_rows.back().end = MaxValue<idx_t>(merged_rows.back().end, range.end);
+		} else {
+			merged_rows.push_back(range);
+		}
+	}
+	// we scan the row group one vector at a time - only vectors that are skipped entirely can be skipped
+	for (auto &range : merged_rows) {
+		auto start = AlignValue<idx_t, STANDARD_VECTOR_SIZE>(range.start);
+		auto end = range.end == group_rows ? group_rows : range.end / STANDARD_VECTOR_SIZE * STANDARD_VECTOR_SIZE;
+		if (start < end) {
+			state.skipped_rows.push_back(ParquetRowRange {start, end});
+		}
+	}
+	if (state.skipped_rows.empty()) {
+		return;
+	}
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		root_reader.GetChildReader(reader_data.column_ids[col_idx])->InitializePageSkipping(state.skipped_rows);
+	}
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -680,6 +913,13 @@ idx_t ParquetReader::NumRowGroups() {
 	return GetFileMetadata()->row_groups.size();
 }
 
+bool ParquetReader::ReadsAhead() {
+	if (!file_handle->CanSeek() || (file_handle->OnDiskFile() && !parquet_options.prefetch_all_files)) {
+		return false;
+	}
+	return !reader_data.filters && parquet_options.prefetch_io_threads > 1;
+}
+
 void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t> groups_to_read) {
 	state.current_group = -1;
 	state.finished = false;
@@ -689,9 +929,11 @@ void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t>
 	if (!state.file_handle || state.file_handle->path != file_handle->path) {
 		auto flags = FileFlags::FILE_FLAGS_READ;
 
-		if (!file_handle->OnDiskFile() && file_handle->CanSeek()) {
+		if (file_handle->CanSeek() && (!file_handle->OnDiskFile() || parquet_options.prefetch_all_files)) {
 			state.prefetch_mode = true;
-			flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+			if (!file_handle->OnDiskFile()) {
+				flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+			}
 		} else {
 			state.prefetch_mode = false;
 		}
@@ -700,9 +942,178 @@ void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t>
 	}
 
 	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode);
+	if (state.prefetch_mode) {
+		auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+		auto flags = FileFlags::FILE_FLAGS_READ;
+		if (!state.file_handle->OnDiskFile()) {
+			flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+		}
+		trans.EnableConcurrentPrefetch(prefetch_io_pool, fs, flags, parquet_options.prefetch_io_threads);
+	}
 	state.root_reader = CreateReader();
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
+
+	// the columns of a row group can only be decoded in parallel if we read them in lock-step: filters are evaluated
+	// column by column, and casts may reference the intermediate vectors of the cast reader
+	state.parallel_decode = state.decode_scheduler && state.file_handle->OnDiskFile() && !state.prefetch_mode &&
+	                        !reader_data.filters && reader_data.cast_map.empty() && reader_data.column_ids.size() > 1;
+	state.column_protocols.clear();
+	state.decode_batch.reset();
+	if (state.parallel_decode) {
+		// positional reads on local files are thread-safe, but every column needs its own transport
+		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+			state.column_protocols.push_back(CreateThriftFileProtocol(allocator, *state.file_handle, false));
+		}
+		if (!state.decode_producer) {
+			state.decode_producer = state.decode_scheduler->CreateProducer();
+		}
+	}
+}
+
+struct ParquetDecodeColumn {
+	optional_ptr<ColumnReader> reader;
+	idx_t file_col_idx;
+	vector<Vector> vectors;
+};
+
+//! A batch of vectors of every column in the row group, the columns are claimed and decoded by the scanning thread and
+//! by the ParquetDecodeTasks
+class ParquetDecodeBatch {
+public:
+	ParquetDecodeBatch(Allocator &allocator_p, vector<ParquetDecodeColumn> columns_p, vector<idx_t> vector_sizes_p)
+	    : allocator(allocator_p), columns(std::move(columns_p)), vector_sizes(std::move(vector_sizes_p)),
+	      next_column(0), finished_columns(0) {
+	}
+
+	Allocator &allocator;
+	vector<ParquetDecodeColumn> columns;
+	vector<idx_t> vector_sizes;
+	atomic<idx_t> next_column;
+	atomic<idx_t> finished_columns;
+
+	mutex error_lock;
+	ErrorData error;
+
+public:
+	void DecodeColumns() {
+		while (true) {
+			auto col_idx = next_column++;
+			if (col_idx >= columns.size()) {
+				return;
+			}
+			try {
+				DecodeColumn(columns[col_idx]);
+			} catch (std::exception &ex) {
+				lock_guard<mutex> guard(error_lock);
+				error = ErrorData(ex);
+			} catch (...) { // LCOV_EXCL_START
+				lock_guard<mutex> guard(error_lock);
+				error = ErrorData("Unknown exception while decoding Parquet column");
+			} // LCOV_EXCL_STOP
+			finished_columns++;
+		}
+	}
+
+	bool Finished() const {
+		return finished_columns >= columns.size();
+	}
+
+private:
+	void DecodeColumn(ParquetDecodeColumn &column) {
+		ResizeableBuffer define_buf;
+		ResizeableBuffer repeat_buf;
+		define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
+		repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
+		auto define_ptr = (uint8_t *)define_buf.ptr;
+		auto repeat_ptr = (uint8_t *)repeat_buf.ptr;
+
+		for (idx_t vector_idx = 0; vector_idx < vector_sizes.size(); vector_idx++) {
+			auto count = vector_sizes[vector_idx];
+			parquet_filter_t filter_mask;
+			filter_mask.set();
+			for (idx_t i = count; i < STANDARD_VECTOR_SIZE; i++) {
+				filter_mask.set(i, false);
+			}
+			define_buf.zero();
+			repeat_buf.zero();
+
+			auto &result_vector = column.vectors[vector_idx];
+			auto rows_read = column.reader->Read(count, filter_mask, define_ptr, repeat_ptr, result_vector);
+			if (rows_read != count) {
+				throw InvalidInputException("Mismatch in parquet read for column %llu, expected %llu rows, got %llu",
+				                            column.file_col_idx, count, rows_read);
+			}
+		}
+	}
+};
+
+class ParquetDecodeTask : public Task {
+public:
+	explicit ParquetDecodeTask(shared_ptr<ParquetDecodeBatch> batch_p) : batch(std::move(batch_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		batch->DecodeColumns();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<ParquetDecodeBatch> batch;
+};
+
+void ParquetReader::DecodeBatch(ParquetReaderScanState &state, DataChunk &result) {
+	//! The amount of vectors per column that are decoded by a single task
+	static constexpr const idx_t PARALLEL_DECODE_VECTORS = 8;
+
+	auto remaining_rows = GetGroup(state).num_rows - state.group_offset;
+	vector<idx_t> vector_sizes;
+	for (idx_t offset = 0; offset < remaining_rows && vector_sizes.size() < PARALLEL_DECODE_VECTORS;
+	     offset += STANDARD_VECTOR_SIZE) {
+		vector_sizes.push_back(MinValue<idx_t>(STANDARD_VECTOR_SIZE, remaining_rows - offset));
+	}
+
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	vector<ParquetDecodeColumn> columns;
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		ParquetDecodeColumn column;
+		column.file_col_idx = reader_data.column_ids[col_idx];
+		column.reader = root_reader.GetChildReader(column.file_col_idx);
+		auto &type = result.data[reader_data.column_mapping[col_idx]].GetType();
+		column.vectors.reserve(vector_sizes.size());
+		for (idx_t vector_idx = 0; vector_idx < vector_sizes.size(); vector_idx++) {
+			column.vectors.emplace_back(type);
+		}
+		columns.push_back(std::move(column));
+	}
+	auto batch = make_shared_ptr<ParquetDecodeBatch>(allocator, std::move(columns), std::move(vector_sizes));
+
+	// the scanning thread decodes columns as well, so we schedule one task less than the amount of threads we can use
+	auto &scheduler = *state.decode_scheduler;
+	auto task_count = MinValue<idx_t>(NumericCast<idx_t>(scheduler.NumberOfThreads()), batch->columns.size());
+	for (idx_t i = 1; i < task_count; i++) {
+		scheduler.ScheduleTask(*state.decode_producer, make_shared_ptr<ParquetDecodeTask>(batch));
+	}
+	batch->DecodeColumns();
+	shared_ptr<Task> task;
+	while (!batch->Finished()) {
+		// other threads are still decoding, help out with tasks that have not been picked up yet
+		if (scheduler.GetTaskFromProducer(*state.decode_producer, task)) {
+			task->Execute(TaskExecutionMode::PROCESS_ALL);
+			task.reset();
+		} else {
+			TaskScheduler::YieldThread();
+		}
+	}
+	// tasks that were not picked up by other threads have nothing left to do
+	while (scheduler.GetTaskFromProducer(*state.decode_producer, task)) {
+		task.reset();
+	}
+	if (batch->error.HasError()) {
+		batch->error.Throw();
+	}
+	state.decode_batch = std::move(batch);
+	state.decode_batch_idx = 0;
 }
 
 void FilterIsNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
@@ -912,13 +1323,16 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		state.group_offset = 0;
 
 		auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
-		trans.ClearPrefetch();
 		state.current_group_prefetched = false;
 
 		if ((idx_t)state.current_group == state.group_idx_list.size()) {
+			trans.ClearPrefetch();
 			state.finished = true;
 			return false;
 		}
+		// ranges of this row group may have been prefetched while we were decoding the previous one
+		auto group_offset = GetGroupOffset(state);
+		trans.ClearPrefetch(group_offset, group_offset + GetGroupSpan(state));
 
 		uint64_t to_scan_compressed_bytes = 0;
 		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
@@ -930,6 +1344,20 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
 
+		PreparePageSkipping(state);
+
+		if (state.parallel_decode) {
+			// every column is read through its own protocol, so the columns can be decoded concurrently
+			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+			auto &group = GetGroup(state);
+			for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+				auto child_reader = root_reader.GetChildReader(reader_data.column_ids[col_idx]);
+				child_reader->InitializeRead(state.group_idx_list[state.current_group], group.columns,
+				                             *state.column_protocols[col_idx]);
+			}
+			state.decode_batch.reset();
+		}
+
 		auto &group = GetGroup(state);
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
 
@@ -976,6 +1404,9 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 					trans.PrefetchRegistered();
 				}
 			}
+			if (!reader_data.filters) {
+				PrefetchNextGroup(state);
+			}
 		}
 		return true;
 	}
@@ -988,6 +1419,23 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return false; // end of last group, we are done
 	}
 
+	// skip the rows that the page index shows cannot match the filters without reading them
+	while (state.skipped_rows_idx < state.skipped_rows.size() &&
+	       state.skipped_rows[state.skipped_rows_idx].end <= state.group_offset) {
+		state.skipped_rows_idx++;
+	}
+	if (state.skipped_rows_idx < state.skipped_rows.size() &&
+	    state.skipped_rows[state.skipped_rows_idx].start <= state.group_offset) {
+		auto skip_count = state.skipped_rows[state.skipped_rows_idx].end - state.group_offset;
+		auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+			root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+		}
+		result.SetCardinality(0);
+		state.group_offset += skip_count;
+		return true;
+	}
+
 	// we evaluate simple table filters directly in this scan so we can skip decoding column data that's never going to
 	// be relevant
 	parquet_filter_t filter_mask;
@@ -1058,6 +1506,17 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		}
 
 		result.Slice(state.sel, sel_size);
+	} else if (state.parallel_decode) {
+		if (!state.decode_batch || state.decode_batch_idx >= state.decode_batch->vector_sizes.size()) {
+			DecodeBatch(state, result);
+		}
+		auto &batch = *state.decode_batch;
+		D_ASSERT(batch.vector_sizes[state.decode_batch_idx] == this_output_chunk_rows);
+		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+			auto &result_vector = result.data[reader_data.column_mapping[col_idx]];
+			result_vector.Reference(batch.columns[col_idx].vectors[state.decode_batch_idx]);
+		}
+		state.decode_batch_idx++;
 	} else {
 		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
 			auto file_col_idx = reader_data.column_ids[col_idx];
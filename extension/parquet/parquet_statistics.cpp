@@ -286,8 +286,29 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformStatistics(reader, column_chunk.meta_data.statistics);
+}
 
+unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformPageStatistics(const ColumnReader &reader,
+                                                                           const ColumnIndex &column_index,
+                                                                           idx_t page_idx) {
+	if (page_idx >= column_index.min_values.size() || page_idx >= column_index.max_values.size()) {
+		return nullptr;
+	}
+	// the page index stores the min/max of every page in the same format as the min_value/max_value statistics
+	duckdb_parquet::format::Statistics parquet_stats;
+	parquet_stats.__set_min_value(column_index.min_values[page_idx]);
+	parquet_stats.__set_max_value(column_index.max_values[page_idx]);
+	if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+		parquet_stats.__set_null_count(column_index.null_counts[page_idx]);
+	}
+	return TransformStatistics(reader, parquet_stats);
+}
+
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformStatistics(const ColumnReader &reader,
+                                            const duckdb_parquet::format::Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> row_group_stats;
 	auto &type = reader.Type();
 	auto &s_ele = reader.Schema();
 
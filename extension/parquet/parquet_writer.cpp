@@ -25,12 +25,14 @@ using namespace duckdb_apache::thrift;            // NOLINT
 using namespace duckdb_apache::thrift::protocol;  // NOLINT
 using namespace duckdb_apache::thrift::transport; // NOLINT
 
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileCryptoMetaData;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
 using duckdb_parquet::format::PageType;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
@@ -353,10 +355,15 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalT
                              CompressionCodec::type codec, ChildFieldIDs field_ids_p,
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
-                             double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p)
+                             double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
+                             bool write_page_index_p, const vector<string> &bloom_filter_columns_p,
+                             ParquetVersion parquet_version_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
-      dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p) {
+      dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
+      write_page_index(write_page_index_p),
+      bloom_filter_columns(bloom_filter_columns_p.begin(), bloom_filter_columns_p.end()),
+      parquet_version(parquet_version_p) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -373,7 +380,7 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalT
 	protocol = tproto_factory.getProtocol(std::make_shared<MyTransport>(*writer));
 
 	file_meta_data.num_rows = 0;
-	file_meta_data.version = 1;
+	file_meta_data.version = static_cast<int32_t>(parquet_version);
 
 	file_meta_data.__isset.created_by = true;
 	file_meta_data.created_by = "DuckDB";
@@ -542,6 +549,84 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 	prepared.heaps.clear();
 }
 
+void ParquetWriter::AddColumnChunkIndexes(idx_t column_idx, unique_ptr<ColumnIndex> column_index,
+                                          unique_ptr<OffsetIndex> offset_index,
+                                          unique_ptr<ParquetBloomFilter> bloom_filter) {
+	// this is called while flushing a row group (i.e. while holding the lock) before the row group is appended
+	ParquetColumnChunkIndexes indexes;
+	indexes.row_group_idx = file_meta_data.row_groups.size();
+	indexes.column_idx = column_idx;
+	indexes.column_index = std::move(column_index);
+	indexes.offset_index = std::move(offset_index);
+	indexes.bloom_filter = std::move(bloom_filter);
+	column_chunk_indexes.push_back(std::move(indexes));
+}
+
+static void WriteEmptyUnionField(TProtocol &protocol, const char *name, int16_t field_id, const char *member) {
+	protocol.writeFieldBegin(name, T_STRUCT, field_id);
+	protocol.writeStructBegin(name);
+	protocol.writeFieldBegin(member, T_STRUCT, 1);
+	protocol.writeStructBegin(member);
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+}
+
+void ParquetWriter::WriteBloomFilter(const ParquetBloomFilter &bloom_filter) {
+	// the BloomFilterHeader is not part of our generated thrift code, so we write it field-by-field
+	// the algorithm, hash and compression fields are unions of which we always use the first (empty) member
+	auto &proto = *protocol;
+	proto.writeStructBegin("BloomFilterHeader");
+	proto.writeFieldBegin("numBytes", T_I32, 1);
+	proto.writeI32(NumericCast<int32_t>(bloom_filter.Size()));
+	proto.writeFieldEnd();
+	WriteEmptyUnionField(proto, "algorithm", 2, "BLOCK");
+	WriteEmptyUnionField(proto, "hash", 3, "XXHASH");
+	WriteEmptyUnionField(proto, "compression", 4, "UNCOMPRESSED");
+	proto.writeFieldStop();
+	proto.writeStructEnd();
+	WriteData(bloom_filter.Data(), NumericCast<uint32_t>(bloom_filter.Size()));
+}
+
+void ParquetWriter::WriteColumnChunkIndexes() {
+	// following the format specification we first write all bloom filters, then all column indexes and finally all
+	// offset indexes, so that readers can fetch the page index of the entire file in a single read
+	for (auto &indexes : column_chunk_indexes) {
+		if (!indexes.bloom_filter) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[indexes.row_group_idx].columns[indexes.column_idx];
+		auto offset = writer->GetTotalWritten();
+		WriteBloomFilter(*indexes.bloom_filter);
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(offset));
+		column_chunk.meta_data.__set_bloom_filter_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	for (auto &indexes : column_chunk_indexes) {
+		if (!indexes.column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[indexes.row_group_idx].columns[indexes.column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(*indexes.column_index);
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_column_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	for (auto &indexes : column_chunk_indexes) {
+		if (!indexes.offset_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[indexes.row_group_idx].columns[indexes.column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(*indexes.offset_index);
+		column_chunk.__set_offset_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_offset_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	column_chunk_indexes.clear();
+}
+
 void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	if (buffer.Count() == 0) {
 		return;
@@ -555,6 +640,8 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 }
 
 void ParquetWriter::Finalize() {
+	WriteColumnChunkIndexes();
+
 	auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
@@ -50,6 +50,7 @@
 #include "duckdb/common/enums/statement_type.hpp"
 #include "duckdb/common/enums/subquery_type.hpp"
 #include "duckdb/common/enums/tableref_type.hpp"
+#include "duckdb/common/enums/thread_pinning_mode.hpp"
 #include "duckdb/common/enums/undo_flags.hpp"
 #include "duckdb/common/enums/vector_type.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
@@ -4357,6 +4358,8 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "DUPLICATE_GROUPS";
 	case OptimizerType::REORDER_FILTER:
 		return "REORDER_FILTER";
+	case OptimizerType::JOIN_FILTER_PUSHDOWN:
+		return "JOIN_FILTER_PUSHDOWN";
 	case OptimizerType::EXTENSION:
 		return "EXTENSION";
 	default:
@@ -4420,6 +4423,9 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "REORDER_FILTER")) {
 		return OptimizerType::REORDER_FILTER;
 	}
+	if (StringUtil::Equals(value, "JOIN_FILTER_PUSHDOWN")) {
+		return OptimizerType::JOIN_FILTER_PUSHDOWN;
+	}
 	if (StringUtil::Equals(value, "EXTENSION")) {
 		return OptimizerType::EXTENSION;
 	}
@@ -4877,6 +4883,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "POSITIONAL_JOIN";
 	case PhysicalOperatorType::ASOF_JOIN:
 		return "ASOF_JOIN";
+	case PhysicalOperatorType::INDEX_JOIN:
+		return "INDEX_JOIN";
 	case PhysicalOperatorType::UNION:
 		return "UNION";
 	case PhysicalOperatorType::RECURSIVE_CTE:
@@ -5077,6 +5085,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "ASOF_JOIN")) {
 		return PhysicalOperatorType::ASOF_JOIN;
 	}
+	if (StringUtil::Equals(value, "INDEX_JOIN")) {
+		return PhysicalOperatorType::INDEX_JOIN;
+	}
 	if (StringUtil::Equals(value, "UNION")) {
 		return PhysicalOperatorType::UNION;
 	}
@@ -6782,6 +6793,10 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::BLOOM_FILTER:
+		return "BLOOM_FILTER";
+	case TableFilterType::IN_FILTER:
+		return "IN_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -6807,6 +6822,35 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "BLOOM_FILTER")) {
+		return TableFilterType::BLOOM_FILTER;
+	}
+	if (StringUtil::Equals(value, "IN_FILTER")) {
+		return TableFilterType::IN_FILTER;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
+template<>
+const char* EnumUtil::ToChars<TableFunctionInitialization>(TableFunctionInitialization value) {
+	switch(value) {
+	case TableFunctionInitialization::INITIALIZE_ON_SCHEDULE:
+		return "INITIALIZE_ON_SCHEDULE";
+	case TableFunctionInitialization::INITIALIZE_ON_EXECUTE:
+		return "INITIALIZE_ON_EXECUTE";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TableFunctionInitialization EnumUtil::FromString<TableFunctionInitialization>(const char *value) {
+	if (StringUtil::Equals(value, "INITIALIZE_ON_SCHEDULE")) {
+		return TableFunctionInitialization::INITIALIZE_ON_SCHEDULE;
+	}
+	if (StringUtil::Equals(value, "INITIALIZE_ON_EXECUTE")) {
+		return TableFunctionInitialization::INITIALIZE_ON_EXECUTE;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -6972,6 +7016,34 @@ TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value)
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<ThreadPinningMode>(ThreadPinningMode value) {
+	switch(value) {
+	case ThreadPinningMode::NONE:
+		return "NONE";
+	case ThreadPinningMode::CORES:
+		return "CORES";
+	case ThreadPinningMode::NUMA:
+		return "NUMA";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+ThreadPinningMode EnumUtil::FromString<ThreadPinningMode>(const char *value) {
+	if (StringUtil::Equals(value, "NONE")) {
+		return ThreadPinningMode::NONE;
+	}
+	if (StringUtil::Equals(value, "CORES")) {
+		return ThreadPinningMode::CORES;
+	}
+	if (StringUtil::Equals(value, "NUMA")) {
+		return ThreadPinningMode::NUMA;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value) {
 	switch(value) {
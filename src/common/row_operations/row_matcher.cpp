@@ -192,9 +192,20 @@ static idx_t GenericNestedMatch(Vector &lhs_vector, const TupleDataVectorFormat
 }
 
 void RowMatcher::Initialize(const bool no_match_sel, const TupleDataLayout &layout, const Predicates &predicates) {
+	vector<column_t> all_columns;
+	for (column_t col_idx = 0; col_idx < predicates.size(); col_idx++) {
+		all_columns.push_back(col_idx);
+	}
+	Initialize(no_match_sel, layout, predicates, all_columns);
+}
+
+void RowMatcher::Initialize(const bool no_match_sel, const TupleDataLayout &layout, const Predicates &predicates,
+                            const vector<column_t> &columns_p) {
+	D_ASSERT(predicates.size() == columns_p.size());
+	columns = columns_p;
 	match_functions.reserve(predicates.size());
-	for (idx_t col_idx = 0; col_idx < predicates.size(); col_idx++) {
-		match_functions.push_back(GetMatchFunction(no_match_sel, layout.GetTypes()[col_idx], predicates[col_idx]));
+	for (idx_t i = 0; i < predicates.size(); i++) {
+		match_functions.push_back(GetMatchFunction(no_match_sel, layout.GetTypes()[columns[i]], predicates[i]));
 	}
 }
 
@@ -202,8 +213,9 @@ idx_t RowMatcher::Match(DataChunk &lhs, const vector<TupleDataVectorFormat> &lhs
                         idx_t count, const TupleDataLayout &rhs_layout, Vector &rhs_row_locations,
                         SelectionVector *no_match_sel, idx_t &no_match_count) {
 	D_ASSERT(!match_functions.empty());
-	for (idx_t col_idx = 0; col_idx < match_functions.size(); col_idx++) {
-		const auto &match_function = match_functions[col_idx];
+	for (idx_t i = 0; i < match_functions.size(); i++) {
+		const auto &match_function = match_functions[i];
+		const auto col_idx = columns[i];
 		count =
 		    match_function.function(lhs.data[col_idx], lhs_formats[col_idx], sel, count, rhs_layout, rhs_row_locations,
 		                            col_idx, match_function.child_functions, no_match_sel, no_match_count);
@@ -51,10 +51,11 @@ int Comparators::CompareTuple(const SBScanState &left, const SBScanState &right,
 	return comp_res;
 }
 
-int Comparators::CompareVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type) {
+int Comparators::CompareVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type,
+                            const idx_t &prefix_len) {
 	switch (type.InternalType()) {
 	case PhysicalType::VARCHAR:
-		return TemplatedCompareVal<string_t>(l_ptr, r_ptr);
+		return CompareStringVal(l_ptr, r_ptr, prefix_len);
 	case PhysicalType::LIST:
 	case PhysicalType::ARRAY:
 	case PhysicalType::STRUCT: {
@@ -92,12 +93,12 @@ int Comparators::BreakBlobTie(const idx_t &tie_col, const SBScanState &left, con
 		UnswizzleSingleValue(l_data_ptr, l_heap_ptr, type);
 		UnswizzleSingleValue(r_data_ptr, r_heap_ptr, type);
 		// Compare
-		result = CompareVal(l_data_ptr, r_data_ptr, type);
+		result = CompareVal(l_data_ptr, r_data_ptr, type, sort_layout.prefix_lengths[tie_col]);
 		// Swizzle the pointers back to offsets
 		SwizzleSingleValue(l_data_ptr, l_heap_ptr, type);
 		SwizzleSingleValue(r_data_ptr, r_heap_ptr, type);
 	} else {
-		result = CompareVal(l_data_ptr, r_data_ptr, type);
+		result = CompareVal(l_data_ptr, r_data_ptr, type, sort_layout.prefix_lengths[tie_col]);
 	}
 	return order * result;
 }
@@ -115,6 +116,24 @@ int Comparators::TemplatedCompareVal(const data_ptr_t &left_ptr, const data_ptr_
 	}
 }
 
+int Comparators::CompareStringVal(const data_ptr_t &left_ptr, const data_ptr_t &right_ptr, const idx_t &prefix_len) {
+	const auto left_val = Load<string_t>(left_ptr);
+	const auto right_val = Load<string_t>(right_ptr);
+	const auto left_size = left_val.GetSize();
+	const auto right_size = right_val.GetSize();
+	const auto min_size = MinValue(left_size, right_size);
+	// the prefix was already compared in the sorting key
+	const auto skip = MinValue(prefix_len, min_size);
+	const auto comp_res = memcmp(left_val.GetData() + skip, right_val.GetData() + skip, min_size - skip);
+	if (comp_res != 0) {
+		return comp_res < 0 ? -1 : 1;
+	}
+	if (left_size == right_size) {
+		return 0;
+	}
+	return left_size < right_size ? -1 : 1;
+}
+
 int Comparators::CompareValAndAdvance(data_ptr_t &l_ptr, data_ptr_t &r_ptr, const LogicalType &type, bool valid) {
 	switch (type.InternalType()) {
 	case PhysicalType::BOOL:
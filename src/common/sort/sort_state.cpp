@@ -70,13 +70,11 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 			prefix_lengths.back() = GetNestedSortingColSize(col_size, expr.return_type);
 		} else if (physical_type == PhysicalType::VARCHAR) {
 			idx_t size_before = col_size;
-			if (stats.back() && StringStats::HasMaxStringLength(*stats.back())) {
+			if (stats.back() && StringStats::HasMaxStringLength(*stats.back()) &&
+			    StringStats::MaxStringLength(*stats.back()) <= SortConstants::MAX_NORMALIZED_STRING_LENGTH) {
+				// The strings fit in the sorting key: sort and merge by comparing the keys only
 				col_size += StringStats::MaxStringLength(*stats.back());
-				if (col_size > 12) {
-					col_size = 12;
-				} else {
-					constant_size.back() = true;
-				}
+				constant_size.back() = true;
 			} else {
 				col_size = 12;
 			}
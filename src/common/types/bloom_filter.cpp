@@ -0,0 +1,69 @@
+#include "duckdb/common/types/bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter() {
+	Initialize(1);
+}
+
+BloomFilter::BloomFilter(idx_t expected_count) {
+	auto bit_count = MaxValue<idx_t>(expected_count, 1) * BITS_PER_KEY;
+	Initialize(NextPowerOfTwo((bit_count + 63) / 64));
+}
+
+void BloomFilter::Initialize(idx_t word_count) {
+	D_ASSERT(word_count > 0 && IsPowerOfTwo(word_count));
+	words.resize(word_count, 0);
+	word_mask = word_count - 1;
+}
+
+void BloomFilter::Insert(Vector &values, idx_t count) {
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(values, hashes, count);
+
+	UnifiedVectorFormat vdata;
+	values.ToUnifiedFormat(count, vdata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			continue;
+		}
+		Insert(hash_data[hdata.sel->get_index(i)]);
+	}
+}
+
+void BloomFilter::Merge(const BloomFilter &other) {
+	if (words.size() != other.words.size()) {
+		throw InternalException("BloomFilter::Merge called on bloom filters of different sizes");
+	}
+	for (idx_t i = 0; i < words.size(); i++) {
+		words[i] |= other.words[i];
+	}
+}
+
+bool BloomFilter::Equals(const BloomFilter &other) const {
+	return words == other.words;
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty(100, "words", words);
+}
+
+BloomFilter BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto words = deserializer.ReadProperty<vector<uint64_t>>(100, "words");
+	if (words.empty() || !IsPowerOfTwo(words.size())) {
+		throw SerializationException("Invalid bloom filter: word count must be a power of two");
+	}
+	BloomFilter result;
+	result.Initialize(words.size());
+	result.words = std::move(words);
+	return result;
+}
+
+} // namespace duckdb
@@ -17,14 +17,18 @@ struct SumSetOperation {
 	}
 	template <class STATE>
 	static void AddValues(STATE &state, idx_t count) {
-		state.isset = true;
+		state.count += count;
+	}
+	template <class STATE>
+	static void RemoveValues(STATE &state, idx_t count) {
+		state.count -= count;
 	}
 };
 
 struct IntegerSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd> {
 	template <class T, class STATE>
 	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
-		if (!state.isset) {
+		if (state.count == 0) {
 			finalize_data.ReturnNull();
 		} else {
 			target = Hugeint::Convert(state.value);
@@ -35,7 +39,7 @@ struct IntegerSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd
 struct SumToHugeintOperation : public BaseSumOperation<SumSetOperation, AddToHugeint> {
 	template <class T, class STATE>
 	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
-		if (!state.isset) {
+		if (state.count == 0) {
 			finalize_data.ReturnNull();
 		} else {
 			target = state.value;
@@ -47,7 +51,7 @@ template <class ADD_OPERATOR>
 struct DoubleSumOperation : public BaseSumOperation<SumSetOperation, ADD_OPERATOR> {
 	template <class T, class STATE>
 	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
-		if (!state.isset) {
+		if (state.count == 0) {
 			finalize_data.ReturnNull();
 		} else {
 			target = state.value;
@@ -61,7 +65,7 @@ using KahanSumOperation = DoubleSumOperation<KahanAdd>;
 struct HugeintSumOperation : public BaseSumOperation<SumSetOperation, HugeintAdd> {
 	template <class T, class STATE>
 	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
-		if (!state.isset) {
+		if (state.count == 0) {
 			finalize_data.ReturnNull();
 		} else {
 			target = state.value;
@@ -88,6 +92,8 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 	case PhysicalType::INT32: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int32_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::INTEGER, LogicalType::HUGEINT);
+		function.window_remove =
+		    AggregateFunction::UnaryUpdate<SumState<int64_t>, int32_t, IntegerSumOperation::RemoveOperation>;
 		function.name = "sum_no_overflow";
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		function.bind = SumNoOverflowBind;
@@ -98,6 +104,8 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 	case PhysicalType::INT64: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int64_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::BIGINT, LogicalType::HUGEINT);
+		function.window_remove =
+		    AggregateFunction::UnaryUpdate<SumState<int64_t>, int64_t, IntegerSumOperation::RemoveOperation>;
 		function.name = "sum_no_overflow";
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		function.bind = SumNoOverflowBind;
@@ -158,6 +166,8 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 	case PhysicalType::INT16: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int16_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::SMALLINT, LogicalType::HUGEINT);
+		function.window_remove =
+		    AggregateFunction::UnaryUpdate<SumState<int64_t>, int16_t, IntegerSumOperation::RemoveOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
 	}
@@ -166,6 +176,8 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int32_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::INTEGER, LogicalType::HUGEINT);
+		function.window_remove =
+		    AggregateFunction::UnaryUpdate<SumState<hugeint_t>, int32_t, SumToHugeintOperation::RemoveOperation>;
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
@@ -174,6 +186,8 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int64_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::BIGINT, LogicalType::HUGEINT);
+		function.window_remove =
+		    AggregateFunction::UnaryUpdate<SumState<hugeint_t>, int64_t, SumToHugeintOperation::RemoveOperation>;
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
@@ -182,6 +196,8 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, hugeint_t, hugeint_t, HugeintSumOperation>(
 		        LogicalType::HUGEINT, LogicalType::HUGEINT);
+		function.window_remove =
+		    AggregateFunction::UnaryUpdate<SumState<hugeint_t>, hugeint_t, HugeintSumOperation::RemoveOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
 	}
@@ -31,7 +31,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
 GroupedAggregateHashTable::AggregateHTAppendState::AggregateHTAppendState()
     : ht_offsets(LogicalType::UBIGINT), hash_salts(LogicalType::HASH), group_compare_vector(STANDARD_VECTOR_SIZE),
       no_match_vector(STANDARD_VECTOR_SIZE), empty_vector(STANDARD_VECTOR_SIZE), new_groups(STANDARD_VECTOR_SIZE),
-      addresses(LogicalType::POINTER) {
+      addresses(LogicalType::POINTER), dictionary_capacity(0), dictionary_entries(STANDARD_VECTOR_SIZE),
+      dictionary_group_addresses(LogicalType::POINTER) {
 }
 
 GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, Allocator &allocator,
@@ -40,7 +41,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), count(0), sink_count(0), materialized_count(0), skip_lookups(false), capacity(0),
+      aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -52,9 +54,26 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
 	InitializePartitionedData();
 	Resize(initial_capacity);
 
+	// Match the group columns, constant-size columns first, because comparing e.g. strings can follow pointers into
+	// their heap. If there are such columns, the hash that is stored in the row is compared before all of them, so
+	// that rows whose salt matches by chance are rejected without touching the heap
+	vector<column_t> match_columns;
+	vector<column_t> variable_size_columns;
+	for (column_t col_idx = 0; col_idx < layout.ColumnCount() - 1; col_idx++) {
+		if (TypeIsConstantSize(layout.GetTypes()[col_idx].InternalType())) {
+			match_columns.push_back(col_idx);
+		} else {
+			variable_size_columns.push_back(col_idx);
+		}
+	}
+	if (!variable_size_columns.empty()) {
+		match_columns.insert(match_columns.begin(), layout.ColumnCount() - 1);
+		match_columns.insert(match_columns.end(), variable_size_columns.begin(), variable_size_columns.end());
+	}
+
 	// Predicates
-	predicates.resize(layout.ColumnCount() - 1, ExpressionType::COMPARE_NOT_DISTINCT_FROM);
-	row_matcher.Initialize(true, layout, predicates);
+	predicates.resize(match_columns.size(), ExpressionType::COMPARE_NOT_DISTINCT_FROM);
+	row_matcher.Initialize(true, layout, predicates, match_columns);
 }
 
 void GroupedAggregateHashTable::InitializePartitionedData() {
@@ -71,6 +90,7 @@ void GroupedAggregateHashTable::InitializePartitionedData() {
 	D_ASSERT(GetLayout().GetRowWidth() == layout.GetRowWidth());
 
 	partitioned_data->InitializeAppendState(state.append_state, TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
+	ResetDictionaryState();
 }
 
 unique_ptr<PartitionedTupleData> &GroupedAggregateHashTable::GetPartitionedData() {
@@ -149,7 +169,8 @@ void GroupedAggregateHashTable::Verify() {
 		D_ASSERT(entry.GetSalt() == aggr_ht_entry_t::ExtractSalt(hash));
 		total_count++;
 	}
-	D_ASSERT(total_count == Count());
+	// Groups that were created without lookups are not in the pointer table
+	D_ASSERT(total_count == (skip_lookups ? 0 : Count()));
 #endif
 }
 
@@ -161,6 +182,18 @@ void GroupedAggregateHashTable::ResetCount() {
 	count = 0;
 }
 
+void GroupedAggregateHashTable::SkipLookups(bool skip_lookups_p) {
+	skip_lookups = skip_lookups_p;
+}
+
+idx_t GroupedAggregateHashTable::GetSinkCount() const {
+	return sink_count;
+}
+
+idx_t GroupedAggregateHashTable::GetMaterializedCount() const {
+	return materialized_count;
+}
+
 void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
 	radix_bits = radix_bits_p;
 }
@@ -226,6 +259,11 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload,
 }
 
 idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter) {
+	idx_t new_group_count;
+	if (TryAddDictionaryGroups(groups, payload, filter, new_group_count)) {
+		return new_group_count;
+	}
+
 	Vector hashes(LogicalType::HASH);
 	groups.Hash(hashes);
 
@@ -249,6 +287,85 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 	VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(layout.GetAggrOffset()), payload.size());
 
 	// Now every cell has an entry, update the aggregates
+	UpdateAggregates(payload, filter);
+	return new_group_count;
+}
+
+bool GroupedAggregateHashTable::TryAddDictionaryGroups(DataChunk &groups, DataChunk &payload,
+                                                       const unsafe_vector<idx_t> &filter, idx_t &new_group_count) {
+	if (groups.ColumnCount() != 1 || groups.data[0].GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return false;
+	}
+	// The dictionaries of the storage hold every entry of a segment, and are shared by all of its vectors
+	auto &group_vector = groups.data[0];
+	auto dictionary_size = DictionaryVector::DictionarySize(group_vector);
+	if (!dictionary_size.IsValid() || dictionary_size.GetIndex() > MAX_DICTIONARY_SIZE) {
+		return false;
+	}
+	auto &dictionary = DictionaryVector::Child(group_vector);
+	auto dictionary_buffer = dictionary.GetBuffer();
+	if (!dictionary_buffer || dictionary.GetVectorType() != VectorType::FLAT_VECTOR) {
+		return false;
+	}
+
+	if (state.dictionary != dictionary_buffer) {
+		// A new dictionary: none of its entries were looked up yet
+		if (dictionary_size.GetIndex() > state.dictionary_capacity) {
+			state.dictionary_capacity = dictionary_size.GetIndex();
+			state.dictionary_addresses = make_unsafe_uniq_array<data_ptr_t>(state.dictionary_capacity);
+		}
+		std::fill_n(state.dictionary_addresses.get(), dictionary_size.GetIndex(), nullptr);
+		state.dictionary = std::move(dictionary_buffer);
+	}
+
+	// Find the entries of the dictionary that were not looked up yet, and mark them so they are looked up only once
+	const auto count = groups.size();
+	const auto &dictionary_sel = DictionaryVector::SelVector(group_vector);
+	auto dictionary_addresses = state.dictionary_addresses.get();
+	auto pending_address = reinterpret_cast<data_ptr_t>(uintptr_t(1));
+	idx_t lookup_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto entry_idx = dictionary_sel.get_index(i);
+		if (!dictionary_addresses[entry_idx]) {
+			dictionary_addresses[entry_idx] = pending_address;
+			state.dictionary_entries.set_index(lookup_count++, entry_idx);
+		}
+	}
+
+	new_group_count = 0;
+	if (lookup_count != 0) {
+		// Find or create the groups of these entries, and cache the addresses of their aggregates
+		auto &dictionary_groups = state.dictionary_groups;
+		if (dictionary_groups.ColumnCount() == 0) {
+			dictionary_groups.InitializeEmpty(groups.GetTypes());
+		}
+		dictionary_groups.data[0].Slice(dictionary, state.dictionary_entries, lookup_count);
+		dictionary_groups.SetCardinality(lookup_count);
+		new_group_count = FindOrCreateGroups(dictionary_groups, state.dictionary_group_addresses, state.new_groups);
+
+		const auto group_addresses = FlatVector::GetData<data_ptr_t>(state.dictionary_group_addresses);
+		for (idx_t i = 0; i < lookup_count; i++) {
+			dictionary_addresses[state.dictionary_entries.get_index(i)] = group_addresses[i] + layout.GetAggrOffset();
+		}
+	}
+	// The remaining rows were not passed to FindOrCreateGroups, but they were added to the HT
+	sink_count += count - lookup_count;
+
+	state.addresses.SetVectorType(VectorType::FLAT_VECTOR);
+	auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	for (idx_t i = 0; i < count; i++) {
+		addresses[i] = dictionary_addresses[dictionary_sel.get_index(i)];
+	}
+
+	UpdateAggregates(payload, filter);
+	return true;
+}
+
+void GroupedAggregateHashTable::ResetDictionaryState() {
+	state.dictionary.reset();
+}
+
+void GroupedAggregateHashTable::UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter) {
 	auto &aggregates = layout.GetAggregates();
 	idx_t filter_idx = 0;
 	idx_t payload_idx = 0;
@@ -277,7 +394,6 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 	}
 
 	Verify();
-	return new_group_count;
 }
 
 void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &result) {
@@ -312,6 +428,11 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	D_ASSERT(addresses_v.GetType() == LogicalType::POINTER);
 	D_ASSERT(state.hash_salts.GetType() == LogicalType::HASH);
 
+	sink_count += groups.size();
+	if (skip_lookups) {
+		return CreateGroupsWithoutLookups(groups, group_hashes_v, addresses_v, new_groups_out);
+	}
+
 	// Need to fit the entire vector, and resize at threshold
 	if (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold()) {
 		Verify();
@@ -340,23 +461,8 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
 
 	// Make a chunk that references the groups and the hashes and convert to unified format
-	if (state.group_chunk.ColumnCount() == 0) {
-		state.group_chunk.InitializeEmpty(layout.GetTypes());
-	}
-	D_ASSERT(state.group_chunk.ColumnCount() == layout.GetTypes().size());
-	for (idx_t grp_idx = 0; grp_idx < groups.ColumnCount(); grp_idx++) {
-		state.group_chunk.data[grp_idx].Reference(groups.data[grp_idx]);
-	}
-	state.group_chunk.data[groups.ColumnCount()].Reference(group_hashes_v);
-	state.group_chunk.SetCardinality(groups);
-
-	// convert all vectors to unified format
+	InitializeGroupChunk(groups, group_hashes_v);
 	auto &chunk_state = state.append_state.chunk_state;
-	TupleDataCollection::ToUnifiedFormat(chunk_state, state.group_chunk);
-	if (!state.group_data) {
-		state.group_data = make_unsafe_uniq_array<UnifiedVectorFormat>(state.group_chunk.ColumnCount());
-	}
-	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
@@ -451,9 +557,55 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 
 	count += new_group_count;
+	materialized_count += new_group_count;
 	return new_group_count;
 }
 
+void GroupedAggregateHashTable::InitializeGroupChunk(DataChunk &groups, Vector &group_hashes_v) {
+	if (state.group_chunk.ColumnCount() == 0) {
+		state.group_chunk.InitializeEmpty(layout.GetTypes());
+	}
+	D_ASSERT(state.group_chunk.ColumnCount() == layout.GetTypes().size());
+	for (idx_t grp_idx = 0; grp_idx < groups.ColumnCount(); grp_idx++) {
+		state.group_chunk.data[grp_idx].Reference(groups.data[grp_idx]);
+	}
+	state.group_chunk.data[groups.ColumnCount()].Reference(group_hashes_v);
+	state.group_chunk.SetCardinality(groups);
+
+	// convert all vectors to unified format
+	auto &chunk_state = state.append_state.chunk_state;
+	TupleDataCollection::ToUnifiedFormat(chunk_state, state.group_chunk);
+	if (!state.group_data) {
+		state.group_data = make_unsafe_uniq_array<UnifiedVectorFormat>(state.group_chunk.ColumnCount());
+	}
+	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
+}
+
+idx_t GroupedAggregateHashTable::CreateGroupsWithoutLookups(DataChunk &groups, Vector &group_hashes_v,
+                                                            Vector &addresses_v, SelectionVector &new_groups_out) {
+	// Every row becomes a new group, the pointer table is not touched
+	InitializeGroupChunk(groups, group_hashes_v);
+	const auto group_count = groups.size();
+	auto &chunk_state = state.append_state.chunk_state;
+	partitioned_data->AppendUnified(state.append_state, state.group_chunk, *FlatVector::IncrementalSelectionVector(),
+	                                group_count);
+	RowOperations::InitializeStates(layout, chunk_state.row_locations, *FlatVector::IncrementalSelectionVector(),
+	                                group_count);
+
+	addresses_v.Flatten(group_count);
+	auto addresses = FlatVector::GetData<data_ptr_t>(addresses_v);
+	const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+	const auto &row_sel = state.append_state.reverse_partition_sel;
+	for (idx_t i = 0; i < group_count; i++) {
+		addresses[i] = row_locations[row_sel.get_index(i)];
+		new_groups_out.set_index(i, i);
+	}
+
+	count += group_count;
+	materialized_count += group_count;
+	return group_count;
+}
+
 // this is to support distinct aggregations where we need to record whether we
 // have already seen a value for a group
 idx_t GroupedAggregateHashTable::FindOrCreateGroups(DataChunk &groups, Vector &group_hashes, Vector &addresses_out,
@@ -555,6 +707,7 @@ void GroupedAggregateHashTable::Combine(TupleDataCollection &other_data, optiona
 void GroupedAggregateHashTable::UnpinData() {
 	partitioned_data->FlushAppendState(state.append_state);
 	partitioned_data->Unpin();
+	ResetDictionaryState();
 }
 
 } // namespace duckdb
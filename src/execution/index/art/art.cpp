@@ -11,6 +11,7 @@
 #include "duckdb/execution/index/art/node4.hpp"
 #include "duckdb/execution/index/art/node48.hpp"
 #include "duckdb/execution/index/art/prefix.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -19,22 +20,29 @@
 
 namespace duckdb {
 
-struct ARTIndexScanState : public IndexScanState {
-
-	//! Scan predicates (single predicate scan or range scan)
-	Value values[2];
-	//! Expressions of the scan predicates
-	ExpressionType expressions[2];
-	bool checked = false;
-	//! All scanned row IDs
-	vector<row_t> result_ids;
-	Iterator iterator;
-};
-
 //===--------------------------------------------------------------------===//
 // ART
 //===--------------------------------------------------------------------===//
 
+//! Within its scope, read-only operations pin the blocks of on-disk buffers instead of copying the buffers into
+//! memory. The blocks are unpinned at the end of the scope, so that the buffer manager can evict them
+class ReadOnlyBufferScope {
+public:
+	explicit ReadOnlyBufferScope(ART &art) : art(art) {
+		for (auto &allocator : *art.allocators) {
+			allocator->PinBuffersReadOnly();
+		}
+	}
+	~ReadOnlyBufferScope() {
+		for (auto &allocator : *art.allocators) {
+			allocator->UnpinBuffers();
+		}
+	}
+
+private:
+	ART &art;
+};
+
 ART::ART(const string &name, const IndexConstraintType index_constraint_type, const vector<column_t> &column_ids,
          TableIOManager &table_io_manager, const vector<unique_ptr<Expression>> &unbound_expressions,
          AttachedDatabase &db, const shared_ptr<array<unique_ptr<FixedSizeAllocator>, ALLOCATOR_COUNT>> &allocators_ptr,
@@ -98,37 +106,46 @@ ART::ART(const string &name, const IndexConstraintType index_constraint_type, co
 // Initialize Predicate Scans
 //===--------------------------------------------------------------------===//
 
-//! Initialize a single predicate scan on the index with the given expression and column IDs
-static unique_ptr<IndexScanState> InitializeScanSinglePredicate(const Transaction &transaction, const Value &value,
-                                                                const ExpressionType expression_type) {
-	// initialize point lookup
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = value;
-	result->expressions[0] = expression_type;
-	return std::move(result);
-}
-
-//! Initialize a two predicate scan on the index with the given expression and column IDs
-static unique_ptr<IndexScanState> InitializeScanTwoPredicates(const Transaction &transaction, const Value &low_value,
-                                                              const ExpressionType low_expression_type,
-                                                              const Value &high_value,
-                                                              const ExpressionType high_expression_type) {
-	// initialize range lookup
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = low_value;
-	result->expressions[0] = low_expression_type;
-	result->values[1] = high_value;
-	result->expressions[1] = high_expression_type;
-	return std::move(result);
-}
-
-unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction, const Expression &index_expr,
-                                                  const Expression &filter_expr) {
+//! The comparisons of a key column with constants
+struct ARTKeyPredicates {
+	Value equal_value;
+	Value low_value;
+	ExpressionType low_type = ExpressionType::INVALID;
+	Value high_value;
+	ExpressionType high_type = ExpressionType::INVALID;
 
-	Value low_value, high_value, equal_value;
-	ExpressionType low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
-	// try to find a matching index for any of the filter expressions
+	void AddComparison(const Value &value, ExpressionType comparison_type) {
+		switch (comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+			equal_value = value;
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			// keep the tightest lower bound
+			if (low_value.IsNull() || low_value < value ||
+			    (low_value == value && comparison_type == ExpressionType::COMPARE_GREATERTHAN)) {
+				low_value = value;
+				low_type = comparison_type;
+			}
+			break;
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			// keep the tightest upper bound
+			if (high_value.IsNull() || value < high_value ||
+			    (high_value == value && comparison_type == ExpressionType::COMPARE_LESSTHAN)) {
+				high_value = value;
+				high_type = comparison_type;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+};
 
+//! Add the comparison of the filter with the index expression to the predicates of the key column
+static void MatchKeyPredicate(const Expression &index_expr, const Expression &filter_expr, PhysicalType key_type,
+                              ARTKeyPredicates &predicates) {
 	// create a matcher for a comparison with a constant
 	ComparisonExpressionMatcher matcher;
 	// match on a comparison type
@@ -142,71 +159,112 @@ unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction
 	vector<reference<Expression>> bindings;
 	if (matcher.Match(const_cast<Expression &>(filter_expr), bindings)) { // NOLINT: Match does not alter the expr
 		// range or equality comparison with constant value
-		// we can use our index here
 		// bindings[0] = the expression
 		// bindings[1] = the index expression
 		// bindings[2] = the constant
 		auto &comparison = bindings[0].get().Cast<BoundComparisonExpression>();
-		auto constant_value = bindings[2].get().Cast<BoundConstantExpression>().value;
+		auto &constant_value = bindings[2].get().Cast<BoundConstantExpression>().value;
+		if (constant_value.IsNull() || constant_value.type().InternalType() != key_type) {
+			return;
+		}
 		auto comparison_type = comparison.type;
 		if (comparison.left->type == ExpressionType::VALUE_CONSTANT) {
 			// the expression is on the right side, we flip them around
 			comparison_type = FlipComparisonExpression(comparison_type);
 		}
-		if (comparison_type == ExpressionType::COMPARE_EQUAL) {
-			// equality value
-			// equality overrides any other bounds so we just break here
-			equal_value = constant_value;
-		} else if (comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
-		           comparison_type == ExpressionType::COMPARE_GREATERTHAN) {
-			// greater than means this is a lower bound
-			low_value = constant_value;
-			low_comparison_type = comparison_type;
-		} else {
-			// smaller than means this is an upper bound
-			high_value = constant_value;
-			high_comparison_type = comparison_type;
-		}
+		predicates.AddComparison(constant_value, comparison_type);
 	} else if (filter_expr.type == ExpressionType::COMPARE_BETWEEN) {
 		// BETWEEN expression
 		auto &between = filter_expr.Cast<BoundBetweenExpression>();
 		if (!between.input->Equals(index_expr)) {
 			// expression doesn't match the index expression
-			return nullptr;
+			return;
 		}
 		if (between.lower->type != ExpressionType::VALUE_CONSTANT ||
 		    between.upper->type != ExpressionType::VALUE_CONSTANT) {
 			// not a constant comparison
-			return nullptr;
+			return;
 		}
-		low_value = (between.lower->Cast<BoundConstantExpression>()).value;
-		low_comparison_type = between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
-		                                              : ExpressionType::COMPARE_GREATERTHAN;
-		high_value = (between.upper->Cast<BoundConstantExpression>()).value;
-		high_comparison_type =
-		    between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
-	}
-
-	if (!equal_value.IsNull() || !low_value.IsNull() || !high_value.IsNull()) {
-		// we can scan this index using this predicate: try a scan
-		unique_ptr<IndexScanState> index_state;
-		if (!equal_value.IsNull()) {
-			// equality predicate
-			index_state = InitializeScanSinglePredicate(transaction, equal_value, ExpressionType::COMPARE_EQUAL);
-		} else if (!low_value.IsNull() && !high_value.IsNull()) {
-			// two-sided predicate
-			index_state = InitializeScanTwoPredicates(transaction, low_value, low_comparison_type, high_value,
-			                                          high_comparison_type);
-		} else if (!low_value.IsNull()) {
-			// less than predicate
-			index_state = InitializeScanSinglePredicate(transaction, low_value, low_comparison_type);
-		} else {
-			D_ASSERT(!high_value.IsNull());
-			index_state = InitializeScanSinglePredicate(transaction, high_value, high_comparison_type);
+		auto &low_value = between.lower->Cast<BoundConstantExpression>().value;
+		auto &high_value = between.upper->Cast<BoundConstantExpression>().value;
+		if (low_value.IsNull() || high_value.IsNull() || low_value.type().InternalType() != key_type ||
+		    high_value.type().InternalType() != key_type) {
+			return;
 		}
-		return index_state;
+		predicates.AddComparison(low_value, between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+		                                                            : ExpressionType::COMPARE_GREATERTHAN);
+		predicates.AddComparison(high_value, between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+		                                                             : ExpressionType::COMPARE_LESSTHAN);
 	}
-	return nullptr;
+}
+
+static ARTKey CreateKey(ArenaAllocator &allocator, PhysicalType type, Value &value);
+
+static void AppendKey(ArenaAllocator &allocator, PhysicalType type, Value &value, vector<data_t> &result) {
+	auto key = CreateKey(allocator, type, value);
+	result.insert(result.end(), key.data, key.data + key.len);
+}
+
+//! Turns a key into the smallest key that is greater than all keys starting with it. Returns false, if there is no
+//! such key
+static bool IncrementKeyPrefix(vector<data_t> &key) {
+	while (!key.empty()) {
+		if (key.back() != NumericLimits<data_t>::Maximum()) {
+			key.back()++;
+			return true;
+		}
+		key.pop_back();
+	}
+	return false;
+}
+
+unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction,
+                                                  const vector<unique_ptr<Expression>> &index_exprs,
+                                                  const vector<unique_ptr<Expression>> &filters) {
+	D_ASSERT(index_exprs.size() <= types.size());
+	ArenaAllocator arena_allocator(Allocator::Get(db));
+
+	// the key columns with an equality predicate form a prefix of the keys
+	vector<data_t> prefix;
+	idx_t column_idx = 0;
+	ARTKeyPredicates range;
+	for (; column_idx < index_exprs.size(); column_idx++) {
+		ARTKeyPredicates predicates;
+		for (auto &filter : filters) {
+			MatchKeyPredicate(*index_exprs[column_idx], *filter, types[column_idx], predicates);
+		}
+		if (predicates.equal_value.IsNull()) {
+			// the range predicates of the first key column without an equality predicate limit the keys further
+			range = predicates;
+			break;
+		}
+		AppendKey(arena_allocator, types[column_idx], predicates.equal_value, prefix);
+	}
+	if (prefix.empty() && range.low_value.IsNull() && range.high_value.IsNull()) {
+		return nullptr;
+	}
+
+	auto result = make_uniq<ARTIndexScanState>();
+	result->lower_bound = prefix;
+	if (!range.low_value.IsNull()) {
+		AppendKey(arena_allocator, types[column_idx], range.low_value, result->lower_bound);
+		if (range.low_type == ExpressionType::COMPARE_GREATERTHAN && !IncrementKeyPrefix(result->lower_bound)) {
+			// no key is greater than the lower bound
+			result->finished = true;
+		}
+	}
+
+	result->upper_bound = prefix;
+	bool inclusive = true;
+	if (!range.high_value.IsNull()) {
+		AppendKey(arena_allocator, types[column_idx], range.high_value, result->upper_bound);
+		inclusive = range.high_type == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+	}
+	if (inclusive && !IncrementKeyPrefix(result->upper_bound)) {
+		// there is no key greater than the upper bound: the scan is not bounded
+		result->upper_bound.clear();
+	}
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -645,6 +703,10 @@ void ART::CommitDrop(IndexLock &index_lock) {
 	for (auto &allocator : *allocators) {
 		allocator->Reset();
 	}
+	if (compatible_copy) {
+		compatible_copy->CommitDrop(index_lock);
+		compatible_copy.reset();
+	}
 	tree.Clear();
 }
 
@@ -787,6 +849,23 @@ bool ART::SearchEqual(ARTKey &key, idx_t max_count, vector<row_t> &result_ids) {
 	return Leaf::GetRowIds(*this, *leaf, result_ids, max_count);
 }
 
+void ART::SearchEqual(const vector<ARTKey> &keys, idx_t count, vector<row_t> &result_ids,
+                      vector<sel_t> &key_positions) {
+	lock_guard<mutex> l(lock);
+	ReadOnlyBufferScope buffer_scope(*this);
+	for (idx_t i = 0; i < count; i++) {
+		if (keys[i].Empty()) {
+			continue;
+		}
+		auto leaf = Lookup(tree, keys[i], 0);
+		if (!leaf) {
+			continue;
+		}
+		Leaf::GetRowIds(*this, *leaf, result_ids, NumericLimits<idx_t>::Maximum());
+		key_positions.resize(result_ids.size(), UnsafeNumericCast<sel_t>(i));
+	}
+}
+
 void ART::SearchEqualJoinNoFetch(ARTKey &key, idx_t &result_size) {
 
 	// we need to look for a leaf
@@ -841,135 +920,61 @@ optional_ptr<const Node> ART::Lookup(const Node &node, const ARTKey &key, idx_t
 }
 
 //===--------------------------------------------------------------------===//
-// Greater Than and Less Than
+// Range Scans
 //===--------------------------------------------------------------------===//
 
-bool ART::SearchGreater(ARTIndexScanState &state, ARTKey &key, bool equal, idx_t max_count, vector<row_t> &result_ids) {
+void ART::Scan(IndexScanState &state, const idx_t max_count, vector<row_t> &result_ids) {
 
-	if (!tree.HasMetadata()) {
-		return true;
+	auto &scan_state = state.Cast<ARTIndexScanState>();
+	if (scan_state.finished) {
+		return;
 	}
-	Iterator &it = state.iterator;
 
-	// find the lowest value that satisfies the predicate
-	if (!it.art) {
-		it.art = this;
-		if (!it.LowerBound(tree, key, equal, 0)) {
-			// early-out, if the maximum value in the ART is lower than the lower bound
-			return true;
+	vector<row_t> row_ids;
+	{
+		lock_guard<mutex> l(lock);
+		ReadOnlyBufferScope buffer_scope(*this);
+		if (!tree.HasMetadata()) {
+			scan_state.finished = true;
+			return;
 		}
-	}
-
-	// after that we continue the scan; we don't need to check the bounds as any value following this value is
-	// automatically bigger and hence satisfies our predicate
-	ARTKey empty_key = ARTKey();
-	return it.Scan(empty_key, max_count, result_ids, false);
-}
-
-bool ART::SearchLess(ARTIndexScanState &state, ARTKey &upper_bound, bool equal, idx_t max_count,
-                     vector<row_t> &result_ids) {
-
-	if (!tree.HasMetadata()) {
-		return true;
-	}
-	Iterator &it = state.iterator;
 
-	if (!it.art) {
+		// the ART might have changed since the previous call, so we always find the lower bound again
+		Iterator it;
 		it.art = this;
-		// find the minimum value in the ART: we start scanning from this value
-		it.FindMinimum(tree);
-		// early-out, if the minimum value is higher than the upper bound
-		if (it.current_key > upper_bound) {
-			return true;
+		if (scan_state.lower_bound.empty()) {
+			it.FindMinimum(tree);
+		} else {
+			auto lower_bound_size = UnsafeNumericCast<uint32_t>(scan_state.lower_bound.size());
+			ARTKey lower_bound(scan_state.lower_bound.data(), lower_bound_size);
+			if (!it.LowerBound(tree, lower_bound, true, 0)) {
+				// early-out, if the maximum value in the ART is lower than the lower bound
+				scan_state.finished = true;
+				return;
+			}
 		}
-	}
-
-	// now continue the scan until we reach the upper bound
-	return it.Scan(upper_bound, max_count, result_ids, equal);
-}
 
-//===--------------------------------------------------------------------===//
-// Closed Range Query
-//===--------------------------------------------------------------------===//
-
-bool ART::SearchCloseRange(ARTIndexScanState &state, ARTKey &lower_bound, ARTKey &upper_bound, bool left_equal,
-                           bool right_equal, idx_t max_count, vector<row_t> &result_ids) {
-
-	Iterator &it = state.iterator;
-
-	// find the first node that satisfies the left predicate
-	if (!it.art) {
-		it.art = this;
-		if (!it.LowerBound(tree, lower_bound, left_equal, 0)) {
-			// early-out, if the maximum value in the ART is lower than the lower bound
-			return true;
+		ARTKey upper_bound;
+		if (!scan_state.upper_bound.empty()) {
+			upper_bound =
+			    ARTKey(scan_state.upper_bound.data(), UnsafeNumericCast<uint32_t>(scan_state.upper_bound.size()));
 		}
-	}
-
-	// now continue the scan until we reach the upper bound
-	return it.Scan(upper_bound, max_count, result_ids, right_equal);
-}
-
-bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, const idx_t max_count,
-               vector<row_t> &result_ids) {
-
-	auto &scan_state = state.Cast<ARTIndexScanState>();
-	vector<row_t> row_ids;
-	bool success;
-
-	// FIXME: the key directly owning the data for a single key might be more efficient
-	D_ASSERT(scan_state.values[0].type().InternalType() == types[0]);
-	ArenaAllocator arena_allocator(Allocator::Get(db));
-	auto key = CreateKey(arena_allocator, types[0], scan_state.values[0]);
-
-	if (scan_state.values[1].IsNull()) {
-
-		// single predicate
-		lock_guard<mutex> l(lock);
-		switch (scan_state.expressions[0]) {
-		case ExpressionType::COMPARE_EQUAL:
-			success = SearchEqual(key, max_count, row_ids);
-			break;
-		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
-			success = SearchGreater(scan_state, key, true, max_count, row_ids);
-			break;
-		case ExpressionType::COMPARE_GREATERTHAN:
-			success = SearchGreater(scan_state, key, false, max_count, row_ids);
-			break;
-		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
-			success = SearchLess(scan_state, key, true, max_count, row_ids);
-			break;
-		case ExpressionType::COMPARE_LESSTHAN:
-			success = SearchLess(scan_state, key, false, max_count, row_ids);
-			break;
-		default:
-			throw InternalException("Index scan type not implemented");
+		if (it.ScanBatch(upper_bound, max_count, row_ids)) {
+			// continue with the next key in the next call
+			auto &next_key = it.current_key.GetBytes();
+			scan_state.lower_bound.assign(next_key.begin(), next_key.end());
+		} else {
+			scan_state.finished = true;
 		}
-
-	} else {
-
-		// two predicates
-		lock_guard<mutex> l(lock);
-
-		D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
-		auto upper_bound = CreateKey(arena_allocator, types[0], scan_state.values[1]);
-
-		bool left_equal = scan_state.expressions[0] == ExpressionType ::COMPARE_GREATERTHANOREQUALTO;
-		bool right_equal = scan_state.expressions[1] == ExpressionType ::COMPARE_LESSTHANOREQUALTO;
-		success = SearchCloseRange(scan_state, key, upper_bound, left_equal, right_equal, max_count, row_ids);
-	}
-
-	if (!success) {
-		return false;
 	}
 	if (row_ids.empty()) {
-		return true;
+		return;
 	}
 
 	// sort the row ids
 	sort(row_ids.begin(), row_ids.end());
 	// duplicate eliminate the row ids and append them to the row ids of the state
-	result_ids.reserve(row_ids.size());
+	result_ids.reserve(result_ids.size() + row_ids.size());
 
 	result_ids.push_back(row_ids[0]);
 	for (idx_t i = 1; i < row_ids.size(); i++) {
@@ -977,7 +982,6 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 			result_ids.push_back(row_ids[i]);
 		}
 	}
-	return true;
 }
 
 //===--------------------------------------------------------------------===//
@@ -1034,6 +1038,7 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 
 	// don't alter the index during constraint checking
 	lock_guard<mutex> l(lock);
+	ReadOnlyBufferScope buffer_scope(*this);
 
 	// first resolve the expressions for the index
 	DataChunk expression_chunk;
@@ -1088,6 +1093,35 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 
 IndexStorageInfo ART::GetStorageInfo(const bool get_buffers) {
 
+	// the blocks of the previous copy are no longer referenced once we serialized the ART again
+	if (compatible_copy) {
+		for (auto &allocator : *compatible_copy->allocators) {
+			allocator->Reset();
+		}
+		compatible_copy.reset();
+	}
+
+	// older versions cannot read compressed leaves, which only exist in nodes that changed in memory
+	auto &config = DBConfig::Get(db);
+	if (config.options.serialization_compatibility.serialization_version >= 2 || !tree.HasMetadata()) {
+		return SerializeStorageInfo(get_buffers);
+	}
+	idx_t in_memory_size = 0;
+	for (auto &allocator : *allocators) {
+		in_memory_size += allocator->GetInMemorySize();
+	}
+	if (!in_memory_size) {
+		return SerializeStorageInfo(get_buffers);
+	}
+
+	// we serialize a copy with plain leaves, so that the tree itself stays compressed
+	compatible_copy = make_uniq<ART>(name, index_constraint_type, column_ids, table_io_manager, unbound_expressions, db);
+	compatible_copy->tree = tree.DecompressedCopy(*this, *compatible_copy);
+	return compatible_copy->SerializeStorageInfo(get_buffers);
+}
+
+IndexStorageInfo ART::SerializeStorageInfo(const bool get_buffers) {
+
 	// set the name and root node
 	IndexStorageInfo info;
 	info.name = name;
@@ -1230,6 +1264,13 @@ void ART::InitializeMerge(ARTFlags &flags) {
 	}
 }
 
+void ART::PrepareMerge(const ARTFlags &flags) {
+	D_ASSERT(owns_data);
+	if (tree.HasMetadata()) {
+		tree.InitializeMerge(*this, flags);
+	}
+}
+
 bool ART::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
 
 	auto &other_art = other_index.Cast<ART>();
@@ -1237,23 +1278,36 @@ bool ART::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
 		return true;
 	}
 
-	if (other_art.owns_data) {
-		if (tree.HasMetadata()) {
-			//  fully deserialize other_index, and traverse it to increment its buffer IDs
-			ARTFlags flags;
-			InitializeMerge(flags);
-			other_art.tree.InitializeMerge(other_art, flags);
-		}
+	if (other_art.owns_data && tree.HasMetadata()) {
+		//  fully deserialize other_index, and traverse it to increment its buffer IDs
+		ARTFlags flags;
+		InitializeMerge(flags);
+		other_art.PrepareMerge(flags);
+	}
+	vector<reference<ART>> other_arts {other_art};
+	return MergePreparedIndexes(other_arts);
+}
 
-		// merge the node storage
+bool ART::MergePreparedIndexes(vector<reference<ART>> &other_arts) {
+
+	// merge the node storage
+	for (auto &other_art : other_arts) {
+		if (!other_art.get().owns_data) {
+			continue;
+		}
 		for (idx_t i = 0; i < allocators->size(); i++) {
-			(*allocators)[i]->Merge(*(*other_art.allocators)[i]);
+			(*allocators)[i]->Merge(*(*other_art.get().allocators)[i]);
 		}
 	}
 
 	// merge the ARTs
-	if (!tree.Merge(*this, other_art.tree)) {
-		return false;
+	for (auto &other_art : other_arts) {
+		if (!other_art.get().tree.HasMetadata()) {
+			continue;
+		}
+		if (!tree.Merge(*this, other_art.get().tree)) {
+			return false;
+		}
 	}
 	return true;
 }
@@ -71,6 +71,20 @@ bool Iterator::Scan(const ARTKey &upper_bound, const idx_t max_count, vector<row
 	return true;
 }
 
+bool Iterator::ScanBatch(const ARTKey &upper_bound, const idx_t max_count, vector<row_t> &result_ids) {
+	do {
+		// no more row IDs within the key bounds
+		if (!upper_bound.Empty() && current_key >= upper_bound) {
+			return false;
+		}
+		Leaf::GetRowIds(*art, last_leaf, result_ids, NumericLimits<idx_t>::Maximum());
+		if (!Next()) {
+			return false;
+		}
+	} while (result_ids.size() < max_count);
+	return true;
+}
+
 void Iterator::FindMinimum(const Node &node) {
 
 	D_ASSERT(node.HasMetadata());
@@ -106,6 +120,12 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 		return false;
 	}
 
+	// the key is a prefix of all keys in this subtree: all of them are greater than or equal to the lower bound
+	if (equal && depth >= key.len) {
+		FindMinimum(node);
+		return true;
+	}
+
 	// we found the lower bound
 	if (node.GetType() == NType::LEAF || node.GetType() == NType::LEAF_INLINED) {
 		if (!equal && current_key == key) {
@@ -145,6 +165,11 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 	nodes.emplace(node, 0);
 
 	for (idx_t i = 0; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+		if (equal && depth + i >= key.len) {
+			// the key is a prefix of all keys in this subtree
+			FindMinimum(prefix.ptr);
+			return true;
+		}
 		// the key down to this node is less than the lower bound, the next key will be
 		// greater than the lower bound
 		if (prefix.data[i] < key[depth + i]) {
@@ -1,10 +1,19 @@
 #include "duckdb/execution/index/art/leaf.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/art/node.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/serializer/encoding_util.hpp"
 
 namespace duckdb {
 
+//! The number of bytes between the count and the Node pointer of a leaf, which hold the compressed row IDs
+static constexpr idx_t COMPRESSED_LEAF_SIZE = sizeof(row_t) * (Node::LEAF_SIZE + 1) - sizeof(uint8_t);
+//! The maximum size of an unsigned LEB128 encoded 64-bit integer
+static constexpr idx_t MAX_VARINT_SIZE = 10;
+static_assert(sizeof(Leaf) == sizeof(uint8_t) + COMPRESSED_LEAF_SIZE + sizeof(Node),
+              "compressed row IDs must fill the bytes between the count and the Node pointer");
+
 void Leaf::New(Node &node, const row_t row_id) {
 
 	// we directly inline this row ID into the node pointer
@@ -18,25 +27,16 @@ void Leaf::New(ART &art, reference<Node> &node, const row_t *row_ids, idx_t coun
 
 	D_ASSERT(count > 1);
 
-	idx_t copy_count = 0;
-	while (count) {
-		node.get() = Node::GetAllocator(art, NType::LEAF).New();
-		node.get().SetMetadata(static_cast<uint8_t>(NType::LEAF));
-
-		auto &leaf = Node::RefMutable<Leaf>(art, node, NType::LEAF);
-
-		leaf.count = UnsafeNumericCast<uint8_t>(MinValue((idx_t)Node::LEAF_SIZE, count));
-
-		for (idx_t i = 0; i < leaf.count; i++) {
-			leaf.row_ids[i] = row_ids[copy_count + i];
-		}
-
-		copy_count += leaf.count;
-		count -= leaf.count;
-
-		node = leaf.ptr;
-		leaf.ptr.Clear();
+	// the row IDs of a compressed leaf chain are sorted
+	vector<row_t> sorted_row_ids;
+	if (!std::is_sorted(row_ids, row_ids + count)) {
+		sorted_row_ids.assign(row_ids, row_ids + count);
+		std::sort(sorted_row_ids.begin(), sorted_row_ids.end());
+		row_ids = sorted_row_ids.data();
 	}
+
+	New(art, node.get());
+	WriteCompressed(art, node, row_ids, count);
 }
 
 Leaf &Leaf::New(ART &art, Node &node) {
@@ -101,39 +101,17 @@ void Leaf::Merge(ART &art, Node &l_node, Node &r_node) {
 	D_ASSERT(l_node.GetType() != NType::LEAF_INLINED);
 	D_ASSERT(r_node.GetType() != NType::LEAF_INLINED);
 
-	reference<Node> l_node_ref(l_node);
-	reference<Leaf> l_leaf = Node::RefMutable<Leaf>(art, l_node_ref, NType::LEAF);
-
-	// find a non-full node
-	while (l_leaf.get().count == Node::LEAF_SIZE) {
-		l_node_ref = l_leaf.get().ptr;
-
-		// the last leaf is full
-		if (!l_leaf.get().ptr.HasMetadata()) {
-			break;
-		}
-		l_leaf = Node::RefMutable<Leaf>(art, l_node_ref, NType::LEAF);
-	}
-
-	// store the last leaf and then append r_node
-	auto last_leaf_node = l_node_ref.get();
-	l_node_ref.get() = r_node;
-	r_node.Clear();
-
-	// append the remaining row IDs of the last leaf node
-	if (last_leaf_node.HasMetadata()) {
-		// find the tail
-		l_leaf = Node::RefMutable<Leaf>(art, l_node_ref, NType::LEAF);
-		while (l_leaf.get().ptr.HasMetadata()) {
-			l_leaf = Node::RefMutable<Leaf>(art, l_leaf.get().ptr, NType::LEAF);
-		}
-		// append the row IDs
-		auto &last_leaf = Node::RefMutable<Leaf>(art, last_leaf_node, NType::LEAF);
-		for (idx_t i = 0; i < last_leaf.count; i++) {
-			l_leaf = l_leaf.get().Append(art, last_leaf.row_ids[i]);
-		}
-		Node::GetAllocator(art, NType::LEAF).Free(last_leaf_node);
-	}
+	// merge the sorted row IDs of both chains into a new compressed chain
+	vector<row_t> row_ids;
+	GetChainRowIds(art, l_node, row_ids);
+	GetChainRowIds(art, r_node, row_ids);
+	std::sort(row_ids.begin(), row_ids.end());
+	row_ids.erase(std::unique(row_ids.begin(), row_ids.end()), row_ids.end());
+
+	Free(art, l_node);
+	Free(art, r_node);
+	New(art, l_node);
+	WriteCompressed(art, l_node, row_ids.data(), row_ids.size());
 }
 
 void Leaf::Insert(ART &art, Node &node, const row_t row_id) {
@@ -146,12 +124,27 @@ void Leaf::Insert(ART &art, Node &node, const row_t row_id) {
 		return;
 	}
 
-	// append to the tail
-	reference<Leaf> leaf = Node::RefMutable<Leaf>(art, node, NType::LEAF);
-	while (leaf.get().ptr.HasMetadata()) {
-		leaf = Node::RefMutable<Leaf>(art, leaf.get().ptr, NType::LEAF);
+	Compress(art, node);
+
+	// find the last leaf whose first row ID is smaller than the row ID, usually the tail
+	reference<Node> node_ref(node);
+	while (true) {
+		auto &leaf = Node::Ref<const Leaf>(art, node_ref, NType::LEAF);
+		if (!leaf.ptr.HasMetadata() || Node::Ref<const Leaf>(art, leaf.ptr, NType::LEAF).GetFirstRowId() > row_id) {
+			break;
+		}
+		node_ref = Node::RefMutable<Leaf>(art, node_ref, NType::LEAF).ptr;
 	}
-	leaf.get().Append(art, row_id);
+
+	// insert the row ID, this might overflow into a new leaf
+	vector<row_t> row_ids;
+	Node::Ref<const Leaf>(art, node_ref, NType::LEAF).DecodeRowIds(row_ids);
+	auto position = std::lower_bound(row_ids.begin(), row_ids.end(), row_id);
+	if (position != row_ids.end() && *position == row_id) {
+		return;
+	}
+	row_ids.insert(position, row_id);
+	WriteCompressed(art, node_ref, row_ids.data(), row_ids.size());
 }
 
 bool Leaf::Remove(ART &art, reference<Node> &node, const row_t row_id) {
@@ -165,51 +158,45 @@ bool Leaf::Remove(ART &art, reference<Node> &node, const row_t row_id) {
 		return false;
 	}
 
-	reference<Leaf> leaf = Node::RefMutable<Leaf>(art, node, NType::LEAF);
+	Compress(art, node);
 
-	// inline the remaining row ID
-	if (leaf.get().count == 2) {
-		if (leaf.get().row_ids[0] == row_id || leaf.get().row_ids[1] == row_id) {
-			auto remaining_row_id = leaf.get().row_ids[0] == row_id ? leaf.get().row_ids[1] : leaf.get().row_ids[0];
-			Node::Free(art, node);
-			New(node, remaining_row_id);
+	// find the leaf that can contain the row ID
+	reference<Node> node_ref(node);
+	while (true) {
+		auto &leaf = Node::Ref<const Leaf>(art, node_ref, NType::LEAF);
+		if (!leaf.ptr.HasMetadata() || Node::Ref<const Leaf>(art, leaf.ptr, NType::LEAF).GetFirstRowId() > row_id) {
+			break;
 		}
-		return false;
+		node_ref = Node::RefMutable<Leaf>(art, node_ref, NType::LEAF).ptr;
 	}
 
-	// get the last row ID (the order within a leaf does not matter)
-	// because we want to overwrite the row ID to remove with that one
-
-	// go to the tail and keep track of the previous leaf node
-	reference<Leaf> prev_leaf(leaf);
-	while (leaf.get().ptr.HasMetadata()) {
-		prev_leaf = leaf;
-		leaf = Node::RefMutable<Leaf>(art, leaf.get().ptr, NType::LEAF);
+	auto &leaf = Node::RefMutable<Leaf>(art, node_ref, NType::LEAF);
+	vector<row_t> row_ids;
+	leaf.DecodeRowIds(row_ids);
+	auto position = std::lower_bound(row_ids.begin(), row_ids.end(), row_id);
+	if (position == row_ids.end() || *position != row_id) {
+		return false;
 	}
+	row_ids.erase(position);
 
-	auto last_idx = leaf.get().count;
-	auto last_row_id = leaf.get().row_ids[last_idx - 1];
-
-	// only one row ID in this leaf segment, free it
-	if (leaf.get().count == 1) {
-		Node::Free(art, prev_leaf.get().ptr);
-		if (last_row_id == row_id) {
-			return false;
-		}
+	if (row_ids.empty()) {
+		// unlink and free the empty leaf
+		auto next_node = leaf.ptr;
+		Node::GetAllocator(art, NType::LEAF).Free(node_ref);
+		node_ref.get() = next_node;
 	} else {
-		leaf.get().count--;
+		// removing a row ID never increases the size of the encoded row IDs, so they still fit into the leaf
+		auto encoded_count = leaf.EncodeRowIds(row_ids.data(), row_ids.size());
+		(void)encoded_count;
+		D_ASSERT(encoded_count == row_ids.size());
 	}
 
-	// find the row ID and copy the last row ID to that position
-	while (node.get().HasMetadata()) {
-		leaf = Node::RefMutable<Leaf>(art, node, NType::LEAF);
-		for (idx_t i = 0; i < leaf.get().count; i++) {
-			if (leaf.get().row_ids[i] == row_id) {
-				leaf.get().row_ids[i] = last_row_id;
-				return false;
-			}
-		}
-		node = leaf.get().ptr;
+	// inline the remaining row ID
+	auto &first_leaf = Node::Ref<const Leaf>(art, node, NType::LEAF);
+	if (!first_leaf.ptr.HasMetadata() && first_leaf.GetCount() == 1) {
+		auto remaining_row_id = first_leaf.GetFirstRowId();
+		Node::Free(art, node);
+		New(node, remaining_row_id);
 	}
 	return false;
 }
@@ -225,7 +212,7 @@ idx_t Leaf::TotalCount(ART &art, const Node &node) {
 	reference<const Node> node_ref(node);
 	while (node_ref.get().HasMetadata()) {
 		auto &leaf = Node::Ref<const Leaf>(art, node_ref, NType::LEAF);
-		count += leaf.count;
+		count += leaf.GetCount();
 		node_ref = leaf.ptr;
 	}
 	return count;
@@ -245,14 +232,7 @@ bool Leaf::GetRowIds(ART &art, const Node &node, vector<row_t> &result_ids, idx_
 
 	} else {
 		// push back all the row IDs of this leaf
-		reference<const Node> last_leaf_ref(node);
-		while (last_leaf_ref.get().HasMetadata()) {
-			auto &leaf = Node::Ref<const Leaf>(art, last_leaf_ref, NType::LEAF);
-			for (idx_t i = 0; i < leaf.count; i++) {
-				result_ids.push_back(leaf.row_ids[i]);
-			}
-			last_leaf_ref = leaf.ptr;
-		}
+		GetChainRowIds(art, node, result_ids);
 	}
 
 	return true;
@@ -266,17 +246,15 @@ bool Leaf::ContainsRowId(ART &art, const Node &node, const row_t row_id) {
 		return node.GetRowId() == row_id;
 	}
 
-	reference<const Node> ref_node(node);
-	while (ref_node.get().HasMetadata()) {
-		auto &leaf = Node::Ref<const Leaf>(art, ref_node, NType::LEAF);
-		for (idx_t i = 0; i < leaf.count; i++) {
-			if (leaf.row_ids[i] == row_id) {
-				return true;
-			}
+	bool passed_row_id = false;
+	reference<const Node> node_ref(node);
+	while (node_ref.get().HasMetadata() && !passed_row_id) {
+		auto &leaf = Node::Ref<const Leaf>(art, node_ref, NType::LEAF);
+		if (leaf.FindRowId(row_id, passed_row_id)) {
+			return true;
 		}
-		ref_node = leaf.ptr;
+		node_ref = leaf.ptr;
 	}
-
 	return false;
 }
 
@@ -292,11 +270,16 @@ string Leaf::VerifyAndToString(ART &art, const Node &node, const bool only_verif
 	while (node_ref.get().HasMetadata()) {
 
 		auto &leaf = Node::Ref<const Leaf>(art, node_ref, NType::LEAF);
-		D_ASSERT(leaf.count <= Node::LEAF_SIZE);
+		D_ASSERT(leaf.IsCompressed() || leaf.count <= Node::LEAF_SIZE);
+		D_ASSERT(leaf.GetCount() > 0);
+
+		vector<row_t> row_ids;
+		leaf.DecodeRowIds(row_ids);
+		D_ASSERT(!leaf.IsCompressed() || std::is_sorted(row_ids.begin(), row_ids.end()));
 
-		str += "Leaf [count: " + to_string(leaf.count) + ", row IDs: ";
-		for (idx_t i = 0; i < leaf.count; i++) {
-			str += to_string(leaf.row_ids[i]) + "-";
+		str += "Leaf [count: " + to_string(row_ids.size()) + ", row IDs: ";
+		for (const auto row_id : row_ids) {
+			str += to_string(row_id) + "-";
 		}
 		str += "] ";
 
@@ -320,14 +303,26 @@ void Leaf::Vacuum(ART &art, Node &node) {
 	}
 }
 
+Node Leaf::DecompressedCopy(ART &art, ART &target_art, const Node &node) {
+
+	D_ASSERT(node.GetType() == NType::LEAF);
+	vector<row_t> row_ids;
+	GetChainRowIds(art, node, row_ids);
+
+	Node copy;
+	reference<Leaf> leaf = New(target_art, copy);
+	for (const auto row_id : row_ids) {
+		leaf = leaf.get().Append(target_art, row_id);
+	}
+	return copy;
+}
+
 void Leaf::MoveInlinedToLeaf(ART &art, Node &node) {
 
 	D_ASSERT(node.GetType() == NType::LEAF_INLINED);
 	auto row_id = node.GetRowId();
 	auto &leaf = New(art, node);
-
-	leaf.count = 1;
-	leaf.row_ids[0] = row_id;
+	leaf.EncodeRowIds(&row_id, 1);
 }
 
 Leaf &Leaf::Append(ART &art, const row_t row_id) {
@@ -344,4 +339,135 @@ Leaf &Leaf::Append(ART &art, const row_t row_id) {
 	return leaf.get();
 }
 
+void Leaf::Compress(ART &art, Node &node) {
+
+	D_ASSERT(node.GetType() == NType::LEAF);
+	if (Node::Ref<const Leaf>(art, node, NType::LEAF).IsCompressed()) {
+		return;
+	}
+
+	vector<row_t> row_ids;
+	GetChainRowIds(art, node, row_ids);
+	std::sort(row_ids.begin(), row_ids.end());
+
+	Free(art, node);
+	New(art, node);
+	WriteCompressed(art, node, row_ids.data(), row_ids.size());
+}
+
+void Leaf::GetChainRowIds(ART &art, const Node &node, vector<row_t> &row_ids) {
+
+	reference<const Node> node_ref(node);
+	while (node_ref.get().HasMetadata()) {
+		auto &leaf = Node::Ref<const Leaf>(art, node_ref, NType::LEAF);
+		leaf.DecodeRowIds(row_ids);
+		node_ref = leaf.ptr;
+	}
+}
+
+void Leaf::WriteCompressed(ART &art, Node &node, const row_t *row_ids, idx_t count) {
+
+	D_ASSERT(count > 0);
+	reference<Leaf> leaf = Node::RefMutable<Leaf>(art, node, NType::LEAF);
+	auto next_node = leaf.get().ptr;
+
+	while (true) {
+		auto encoded_count = leaf.get().EncodeRowIds(row_ids, count);
+		row_ids += encoded_count;
+		count -= encoded_count;
+		if (!count) {
+			break;
+		}
+		leaf = New(art, leaf.get().ptr);
+	}
+	leaf.get().ptr = next_node;
+}
+
+row_t Leaf::GetFirstRowId() const {
+
+	if (!IsCompressed()) {
+		return row_ids[0];
+	}
+	uint64_t row_id;
+	EncodingUtil::DecodeUnsignedLEB128(const_data_ptr_cast(this) + sizeof(uint8_t), row_id);
+	return UnsafeNumericCast<row_t>(row_id);
+}
+
+void Leaf::DecodeRowIds(vector<row_t> &result_ids) const {
+
+	if (!IsCompressed()) {
+		for (idx_t i = 0; i < count; i++) {
+			result_ids.push_back(row_ids[i]);
+		}
+		return;
+	}
+
+	auto data = const_data_ptr_cast(this) + sizeof(uint8_t);
+	idx_t offset = 0;
+	uint64_t row_id = 0;
+	for (idx_t i = 0; i < GetCount(); i++) {
+		uint64_t delta;
+		offset += EncodingUtil::DecodeUnsignedLEB128(data + offset, delta);
+		row_id += delta;
+		result_ids.push_back(UnsafeNumericCast<row_t>(row_id));
+	}
+	D_ASSERT(offset <= COMPRESSED_LEAF_SIZE);
+}
+
+bool Leaf::FindRowId(const row_t row_id, bool &passed_row_id) const {
+
+	if (!IsCompressed()) {
+		for (idx_t i = 0; i < count; i++) {
+			if (row_ids[i] == row_id) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// the row IDs are sorted, so we decode them only up to the first row ID that is not smaller than the row ID
+	auto data = const_data_ptr_cast(this) + sizeof(uint8_t);
+	auto search_id = UnsafeNumericCast<uint64_t>(row_id);
+	idx_t offset = 0;
+	uint64_t current_id = 0;
+	for (idx_t i = 0; i < GetCount(); i++) {
+		uint64_t delta;
+		offset += EncodingUtil::DecodeUnsignedLEB128(data + offset, delta);
+		current_id += delta;
+		if (current_id >= search_id) {
+			passed_row_id = current_id > search_id;
+			return current_id == search_id;
+		}
+	}
+	return false;
+}
+
+idx_t Leaf::EncodeRowIds(const row_t *input_ids, idx_t input_count) {
+
+	auto data = data_ptr_cast(this) + sizeof(uint8_t);
+	data_t varint[MAX_VARINT_SIZE];
+
+	// the first row ID is encoded as is, all other row IDs as the delta to their predecessor
+	idx_t offset = 0;
+	idx_t encoded_count = 0;
+	uint64_t previous_row_id = 0;
+	while (encoded_count < input_count) {
+		auto row_id = UnsafeNumericCast<uint64_t>(input_ids[encoded_count]);
+		D_ASSERT(encoded_count == 0 || row_id > previous_row_id);
+
+		auto size = EncodingUtil::EncodeUnsignedLEB128(varint, row_id - previous_row_id);
+		if (offset + size > COMPRESSED_LEAF_SIZE) {
+			break;
+		}
+		memcpy(data + offset, varint, size);
+		offset += size;
+		previous_row_id = row_id;
+		encoded_count++;
+	}
+
+	D_ASSERT(encoded_count > 0 && encoded_count < COMPRESSED_FLAG);
+	count = static_cast<uint8_t>(encoded_count | COMPRESSED_FLAG);
+	return encoded_count;
+}
+
 } // namespace duckdb
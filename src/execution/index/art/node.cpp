@@ -515,4 +515,67 @@ void Node::Vacuum(ART &art, const ARTFlags &flags) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Decompressed Copy
+//===--------------------------------------------------------------------===//
+
+template <class NODE>
+static Node CopyNode(ART &art, ART &target_art, const Node &node, const NType type) {
+	Node copy;
+	copy = Node::GetAllocator(target_art, type).New();
+	copy.SetMetadata(static_cast<uint8_t>(type));
+	memcpy(data_ptr_cast(&Node::RefMutable<NODE>(target_art, copy, type)),
+	       const_data_ptr_cast(&Node::Ref<const NODE>(art, node, type)), sizeof(NODE));
+	return copy;
+}
+
+Node Node::DecompressedCopy(ART &art, ART &target_art) const {
+
+	D_ASSERT(HasMetadata());
+
+	// the copied nodes still point to the children in the source ART, until we replace them with their copies
+	Node copy = *this;
+	reference<Node> node_ref(copy);
+	while (node_ref.get().GetType() == NType::PREFIX) {
+		node_ref.get() = CopyNode<Prefix>(art, target_art, node_ref, NType::PREFIX);
+		node_ref = RefMutable<Prefix>(target_art, node_ref, NType::PREFIX).ptr;
+	}
+
+	auto &node = node_ref.get();
+	switch (node.GetType()) {
+	case NType::LEAF_INLINED:
+		return copy;
+	case NType::LEAF:
+		node = Leaf::DecompressedCopy(art, target_art, node);
+		return copy;
+	case NType::NODE_4:
+		node = CopyNode<Node4>(art, target_art, node, NType::NODE_4);
+		break;
+	case NType::NODE_16:
+		node = CopyNode<Node16>(art, target_art, node, NType::NODE_16);
+		break;
+	case NType::NODE_48:
+		node = CopyNode<Node48>(art, target_art, node, NType::NODE_48);
+		break;
+	case NType::NODE_256:
+		node = CopyNode<Node256>(art, target_art, node, NType::NODE_256);
+		break;
+	default:
+		throw InternalException("Invalid node type for DecompressedCopy.");
+	}
+
+	uint8_t byte = 0;
+	auto child = node.GetNextChildMutable(target_art, byte);
+	while (child) {
+		*child = child->DecompressedCopy(art, target_art);
+		if (byte == NumericLimits<uint8_t>::Maximum()) {
+			break;
+		}
+
+		byte++;
+		child = node.GetNextChildMutable(target_art, byte);
+	}
+	return copy;
+}
+
 } // namespace duckdb
@@ -6,7 +6,7 @@ namespace duckdb {
 
 FixedSizeAllocator::FixedSizeAllocator(const idx_t segment_size, BlockManager &block_manager)
     : block_manager(block_manager), buffer_manager(block_manager.buffer_manager), segment_size(segment_size),
-      total_segment_count(0) {
+      total_segment_count(0), pin_read_only(false) {
 
 	if (segment_size > Storage::BLOCK_SIZE - sizeof(validity_t)) {
 		throw InternalException("The maximum segment size of fixed-size allocators is " +
@@ -113,6 +113,26 @@ void FixedSizeAllocator::Free(const IndexPointer ptr) {
 	buffer.segment_count--;
 }
 
+void FixedSizeAllocator::PinBuffersReadOnly() {
+	pin_read_only = true;
+}
+
+void FixedSizeAllocator::UnpinBuffers() {
+	pin_read_only = false;
+	for (auto &buffer_id : read_only_buffers) {
+		auto buffer_it = buffers.find(buffer_id);
+		if (buffer_it != buffers.end()) {
+			buffer_it->second.Unpin();
+		}
+	}
+	read_only_buffers.clear();
+}
+
+bool FixedSizeAllocator::InMemory(const IndexPointer ptr) const {
+	D_ASSERT(buffers.find(ptr.GetBufferId()) != buffers.end());
+	return buffers.find(ptr.GetBufferId())->second.InMemory();
+}
+
 void FixedSizeAllocator::Reset() {
 	for (auto &buffer : buffers) {
 		buffer.second.Destroy();
@@ -53,6 +53,10 @@ FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager, const idx_t segmen
 	D_ASSERT(block_handle->BlockId() < MAXIMUM_BLOCK);
 }
 
+void FixedSizeBuffer::Unpin() {
+	read_only_handle.Destroy();
+}
+
 void FixedSizeBuffer::Destroy() {
 	if (InMemory()) {
 		// we can have multiple readers on a pinned block, and unpinning the buffer handle
@@ -144,6 +148,12 @@ void FixedSizeBuffer::Pin() {
 	block_pointer = BlockPointer();
 }
 
+void FixedSizeBuffer::PinReadOnly() {
+	D_ASSERT(!InMemory() && OnDisk());
+	D_ASSERT(block_handle && block_handle->BlockId() < MAXIMUM_BLOCK);
+	read_only_handle = block_manager.buffer_manager.Pin(block_handle);
+}
+
 uint32_t FixedSizeBuffer::GetOffset(const idx_t bitmask_count) {
 
 	// get the bitmask data
@@ -3,11 +3,60 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
 
 namespace duckdb {
 
+static bool TryGetConstantOffset(const Expression &expr, int64_t &offset) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+		return false;
+	}
+	auto &value = expr.Cast<BoundConstantExpression>().value;
+	Value offset_value;
+	if (value.IsNull() || !value.DefaultTryCastAs(LogicalType::BIGINT, offset_value, nullptr)) {
+		return false;
+	}
+	offset = offset_value.GetValue<int64_t>();
+	return true;
+}
+
+//! The number of rows in a sliding ROWS frame that ends at the current row
+static optional_idx GetSlidingFrameSize(const BoundWindowExpression &wexpr) {
+	if (wexpr.start == WindowBoundary::CURRENT_ROW_ROWS) {
+		return 1;
+	}
+	int64_t offset;
+	if (wexpr.start != WindowBoundary::EXPR_PRECEDING_ROWS || !wexpr.start_expr ||
+	    !TryGetConstantOffset(*wexpr.start_expr, offset)) {
+		return optional_idx();
+	}
+	if (offset < 0 || offset == NumericLimits<int64_t>::Maximum()) {
+		return optional_idx();
+	}
+	return NumericCast<idx_t>(offset) + 1;
+}
+
+//! The number of rows that LAG looks back. LEAD can only be streamed if it does not look ahead.
+static optional_idx GetLagOffset(const BoundWindowExpression &wexpr) {
+	int64_t offset = 1;
+	if (wexpr.offset_expr && !TryGetConstantOffset(*wexpr.offset_expr, offset)) {
+		return optional_idx();
+	}
+	if (wexpr.GetExpressionType() == ExpressionType::WINDOW_LEAD) {
+		if (offset == NumericLimits<int64_t>::Minimum()) {
+			return optional_idx();
+		}
+		offset = -offset;
+	}
+	// the rows that are looked back at are kept in a single vector
+	if (offset < 0 || offset > int64_t(STANDARD_VECTOR_SIZE)) {
+		return optional_idx();
+	}
+	return NumericCast<idx_t>(offset);
+}
+
 bool PhysicalStreamingWindow::IsStreamingFunction(unique_ptr<Expression> &expr) {
 	auto &wexpr = expr->Cast<BoundWindowExpression>();
 	if (!wexpr.partitions.empty() || !wexpr.orders.empty() || wexpr.ignore_nulls ||
@@ -17,11 +66,28 @@ bool PhysicalStreamingWindow::IsStreamingFunction(unique_ptr<Expression> &expr)
 	switch (wexpr.type) {
 	// TODO: add more expression types here?
 	case ExpressionType::WINDOW_AGGREGATE:
-		// We can stream aggregates if they are "running totals"
-		// TODO: Support FILTER and DISTINCT
-		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS &&
-		       !wexpr.filter_expr && !wexpr.distinct;
+		// We can stream aggregates if they are "running totals" or over sliding ROWS frames that end at the current row
+		// TODO: Support DISTINCT
+		if (wexpr.end != WindowBoundary::CURRENT_ROW_ROWS || wexpr.distinct) {
+			return false;
+		}
+		if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING) {
+			return true;
+		}
+		return wexpr.aggregate->combine && GetSlidingFrameSize(wexpr).IsValid();
+	case ExpressionType::WINDOW_LAG:
+	case ExpressionType::WINDOW_LEAD:
+		return GetLagOffset(wexpr).IsValid();
 	case ExpressionType::WINDOW_FIRST_VALUE:
+		// The first value is a constant if every frame starts at the first row
+		switch (wexpr.end) {
+		case WindowBoundary::CURRENT_ROW_ROWS:
+		case WindowBoundary::CURRENT_ROW_RANGE:
+		case WindowBoundary::UNBOUNDED_FOLLOWING:
+			return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING;
+		default:
+			return false;
+		}
 	case ExpressionType::WINDOW_PERCENT_RANK:
 	case ExpressionType::WINDOW_RANK:
 	case ExpressionType::WINDOW_RANK_DENSE:
@@ -46,6 +112,236 @@ public:
 	std::atomic<int64_t> row_number;
 };
 
+//! An aggregate over a sliding ROWS frame of a fixed size that ends at the current row. The frame is kept in two
+//! stacks: rows are pushed onto the back stack, whose aggregate is updated with every row, and are popped off the front
+//! stack, which holds the aggregates of all suffixes of its rows. When the front stack runs empty, the rows of the back
+//! stack are flipped onto it. The aggregate of the frame combines a suffix of the front stack with the back stack,
+//! which takes an amortized constant number of aggregate calls per row for any aggregate that can be combined.
+class StreamingWindowSlidingAggregate {
+	static constexpr const idx_t STATES_PER_BLOCK = STANDARD_VECTOR_SIZE;
+
+public:
+	StreamingWindowSlidingAggregate(const BoundWindowExpression &wexpr, idx_t frame_size)
+	    : aggregate(*wexpr.aggregate), bind_data(wexpr.bind_info.get()), frame_size(frame_size),
+	      state_size(AlignValue(aggregate.state_size())),
+	      arena(make_uniq<ArenaAllocator>(Allocator::DefaultAllocator())), back_count(0), front_begin(0),
+	      front_end(0), back_state(make_unsafe_uniq_array<data_t>(state_size)),
+	      frame_state(make_unsafe_uniq_array<data_t>(state_size)),
+	      sourcev(LogicalType::POINTER, data_ptr_cast(&source_ptr)),
+	      targetv(LogicalType::POINTER, data_ptr_cast(&target_ptr)) {
+		aggregate.initialize(back_state.get());
+	}
+
+	~StreamingWindowSlidingAggregate() {
+		for (idx_t i = 0; i < back_count; i++) {
+			Destroy(GetState(row_states, i));
+		}
+		for (idx_t i = front_begin; i < front_end; i++) {
+			Destroy(GetState(suffix_states, i));
+		}
+		Destroy(back_state.get());
+	}
+
+	//! Pushes the row onto the frame and computes the aggregate of the frame
+	void Push(DataChunk &row, bool include_row, Vector &result, idx_t result_idx) {
+		auto row_state = GetState(row_states, back_count++);
+		aggregate.initialize(row_state);
+		if (include_row) {
+			Update(row, row_state);
+			Update(row, back_state.get());
+		}
+
+		// pop the row that left the frame
+		if (front_end - front_begin + back_count > frame_size) {
+			if (front_begin == front_end) {
+				Flip();
+			}
+			Destroy(GetState(suffix_states, front_begin++));
+		}
+
+		if (front_begin == front_end) {
+			Finalize(back_state.get(), result, result_idx);
+		} else if (back_count == 0) {
+			Finalize(GetState(suffix_states, front_begin), result, result_idx);
+		} else {
+			auto state = frame_state.get();
+			aggregate.initialize(state);
+			Combine(GetState(suffix_states, front_begin), state);
+			Combine(back_state.get(), state);
+			Finalize(state, result, result_idx);
+			Destroy(state);
+		}
+	}
+
+private:
+	data_ptr_t GetState(vector<unsafe_unique_array<data_t>> &blocks, idx_t idx) {
+		// states are allocated in blocks so that they never move
+		const auto block_idx = idx / STATES_PER_BLOCK;
+		while (block_idx >= blocks.size()) {
+			blocks.emplace_back(make_unsafe_uniq_array<data_t>(STATES_PER_BLOCK * state_size));
+		}
+		return blocks[block_idx].get() + (idx % STATES_PER_BLOCK) * state_size;
+	}
+
+	void Update(DataChunk &row, data_ptr_t state) {
+		AggregateInputData aggr_input_data(bind_data, *arena);
+		target_ptr = state;
+		aggregate.update(row.data.data(), aggr_input_data, row.ColumnCount(), targetv, 1);
+	}
+
+	void Combine(data_ptr_t source, data_ptr_t target) {
+		AggregateInputData aggr_input_data(bind_data, *arena);
+		source_ptr = source;
+		target_ptr = target;
+		aggregate.combine(sourcev, targetv, aggr_input_data, 1);
+	}
+
+	void Finalize(data_ptr_t state, Vector &result, idx_t result_idx) {
+		AggregateInputData aggr_input_data(bind_data, *arena);
+		target_ptr = state;
+		aggregate.finalize(targetv, aggr_input_data, result, 1, result_idx);
+	}
+
+	void Destroy(data_ptr_t state) {
+		if (!aggregate.destructor) {
+			return;
+		}
+		AggregateInputData aggr_input_data(bind_data, *arena);
+		target_ptr = state;
+		aggregate.destructor(targetv, aggr_input_data, 1);
+	}
+
+	//! Moves the rows of the back stack onto the front stack
+	void Flip() {
+		D_ASSERT(front_begin == front_end);
+		// everything that was allocated since the last flip is destroyed by this flip: the new suffixes go into a new
+		// arena, so that memory use is bounded by the size of the frame
+		auto old_arena = std::move(arena);
+		arena = make_uniq<ArenaAllocator>(Allocator::DefaultAllocator());
+		for (idx_t i = back_count; i-- > 0;) {
+			auto suffix_state = GetState(suffix_states, i);
+			aggregate.initialize(suffix_state);
+			Combine(GetState(row_states, i), suffix_state);
+			if (i + 1 < back_count) {
+				Combine(GetState(suffix_states, i + 1), suffix_state);
+			}
+		}
+		std::swap(arena, old_arena);
+		for (idx_t i = 0; i < back_count; i++) {
+			Destroy(GetState(row_states, i));
+		}
+		Destroy(back_state.get());
+		std::swap(arena, old_arena);
+
+		aggregate.initialize(back_state.get());
+		front_begin = 0;
+		front_end = back_count;
+		back_count = 0;
+	}
+
+private:
+	const AggregateFunction &aggregate;
+	optional_ptr<FunctionData> bind_data;
+	//! The number of rows in the frame
+	const idx_t frame_size;
+	const idx_t state_size;
+	//! The allocator of the aggregates that were created since the last flip
+	unique_ptr<ArenaAllocator> arena;
+
+	//! The states of the single rows on the back stack
+	vector<unsafe_unique_array<data_t>> row_states;
+	idx_t back_count;
+	//! The aggregates of the suffixes of the rows on the front stack
+	vector<unsafe_unique_array<data_t>> suffix_states;
+	idx_t front_begin;
+	idx_t front_end;
+	//! The aggregate of all rows on the back stack
+	unsafe_unique_array<data_t> back_state;
+	//! The aggregate of the frame
+	unsafe_unique_array<data_t> frame_state;
+
+	data_ptr_t source_ptr;
+	Vector sourcev;
+	data_ptr_t target_ptr;
+	Vector targetv;
+};
+
+//! LAG over the rows streaming by keeps the last rows of its argument
+class StreamingWindowLag {
+public:
+	StreamingWindowLag(ClientContext &context, const BoundWindowExpression &wexpr, idx_t offset)
+	    : offset(offset), executor(context), has_default(wexpr.default_expr != nullptr) {
+		auto &allocator = Allocator::Get(context);
+		vector<LogicalType> payload_types;
+		payload_types.push_back(wexpr.children[0]->return_type);
+		executor.AddExpression(*wexpr.children[0]);
+		if (has_default) {
+			payload_types.push_back(wexpr.default_expr->return_type);
+			executor.AddExpression(*wexpr.default_expr);
+		}
+		payload.Initialize(allocator, payload_types);
+
+		vector<LogicalType> history_types {wexpr.children[0]->return_type};
+		history = make_uniq<DataChunk>();
+		history->Initialize(allocator, history_types);
+		next_history = make_uniq<DataChunk>();
+		next_history->Initialize(allocator, history_types);
+	}
+
+	void Execute(DataChunk &input, Vector &result) {
+		const auto count = input.size();
+		payload.Reset();
+		executor.Execute(input, payload);
+		auto &argument = payload.data[0];
+		if (offset == 0) {
+			result.Reference(argument);
+			return;
+		}
+
+		// the rows that are offset rows before a row are in the history, in the input, or do not exist
+		const auto history_count = history->size();
+		const auto default_count = offset > history_count ? MinValue(count, offset - history_count) : 0;
+		const auto lag_count = MinValue(count, offset);
+		if (default_count > 0) {
+			if (has_default) {
+				VectorOperations::Copy(payload.data[1], result, default_count, 0, 0);
+			} else {
+				for (idx_t i = 0; i < default_count; i++) {
+					FlatVector::SetNull(result, i, true);
+				}
+			}
+		}
+		if (lag_count > default_count) {
+			VectorOperations::Copy(history->data[0], result, history_count + lag_count - offset,
+			                       history_count + default_count - offset, default_count);
+		}
+		if (count > offset) {
+			VectorOperations::Copy(argument, result, count - offset, 0, offset);
+		}
+
+		// keep the last offset rows
+		const auto keep_from_input = MinValue(count, offset);
+		const auto keep_from_history = MinValue(history_count, offset - keep_from_input);
+		next_history->Reset();
+		auto &history_vector = next_history->data[0];
+		VectorOperations::Copy(history->data[0], history_vector, history_count, history_count - keep_from_history, 0);
+		VectorOperations::Copy(argument, history_vector, count, count - keep_from_input, keep_from_history);
+		next_history->SetCardinality(keep_from_history + keep_from_input);
+		std::swap(history, next_history);
+	}
+
+private:
+	//! The number of rows to look back
+	const idx_t offset;
+	//! Evaluates the argument and the default value
+	ExpressionExecutor executor;
+	const bool has_default;
+	DataChunk payload;
+	//! The last offset rows of the argument
+	unique_ptr<DataChunk> history;
+	unique_ptr<DataChunk> next_history;
+};
+
 class StreamingWindowState : public OperatorState {
 public:
 	using StateBuffer = vector<data_t>;
@@ -71,12 +367,19 @@ public:
 		aggregate_states.resize(expressions.size());
 		aggregate_bind_data.resize(expressions.size(), nullptr);
 		aggregate_dtors.resize(expressions.size(), nullptr);
+		sliding_aggregates.resize(expressions.size());
+		lags.resize(expressions.size());
 
 		for (idx_t expr_idx = 0; expr_idx < expressions.size(); expr_idx++) {
 			auto &expr = *expressions[expr_idx];
 			auto &wexpr = expr.Cast<BoundWindowExpression>();
 			switch (expr.GetExpressionType()) {
 			case ExpressionType::WINDOW_AGGREGATE: {
+				if (wexpr.start != WindowBoundary::UNBOUNDED_PRECEDING) {
+					auto frame_size = GetSlidingFrameSize(wexpr).GetIndex();
+					sliding_aggregates[expr_idx] = make_uniq<StreamingWindowSlidingAggregate>(wexpr, frame_size);
+					break;
+				}
 				auto &aggregate = *wexpr.aggregate;
 				auto &state = aggregate_states[expr_idx];
 				aggregate_bind_data[expr_idx] = wexpr.bind_info.get();
@@ -100,6 +403,11 @@ public:
 				const_vectors[expr_idx] = make_uniq<Vector>(Value((double)0));
 				break;
 			}
+			case ExpressionType::WINDOW_LAG:
+			case ExpressionType::WINDOW_LEAD: {
+				lags[expr_idx] = make_uniq<StreamingWindowLag>(context, wexpr, GetLagOffset(wexpr).GetIndex());
+				break;
+			}
 			case ExpressionType::WINDOW_RANK:
 			case ExpressionType::WINDOW_RANK_DENSE: {
 				const_vectors[expr_idx] = make_uniq<Vector>(Value((int64_t)1));
@@ -123,6 +431,10 @@ public:
 	vector<aggregate_destructor_t> aggregate_dtors;
 	data_ptr_t state_ptr;
 	Vector statev;
+	vector<unique_ptr<StreamingWindowSlidingAggregate>> sliding_aggregates;
+
+	// LAG and LEAD
+	vector<unique_ptr<StreamingWindowLag>> lags;
 };
 
 unique_ptr<GlobalOperatorState> PhysicalStreamingWindow::GetGlobalOperatorState(ClientContext &context) const {
@@ -160,8 +472,8 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 			state.state_ptr = state.aggregate_states[expr_idx].data();
 			AggregateInputData aggr_input_data(wexpr.bind_info.get(), state.allocator);
 
-			// Check for COUNT(*)
-			if (wexpr.children.empty()) {
+			// Check for COUNT(*) over the running frame
+			if (wexpr.children.empty() && !wexpr.filter_expr && !state.sliding_aggregates[expr_idx]) {
 				D_ASSERT(GetTypeIdSize(result.GetType().InternalType()) == sizeof(int64_t));
 				auto data = FlatVector::GetData<int64_t>(result);
 				int64_t start_row = gstate.row_number;
@@ -181,35 +493,59 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 			}
 
 			DataChunk payload;
-			payload.Initialize(allocator, payload_types);
-			executor.Execute(input, payload);
-
-			// Iterate through them using a single SV
-			payload.Flatten();
 			DataChunk row;
-			row.Initialize(allocator, payload_types);
 			sel_t s = 0;
 			SelectionVector sel(&s);
-			row.Slice(sel, 1);
-			// This doesn't work for STRUCTs because the SV
-			// is not copied to the children when you slice
 			vector<column_t> structs;
-			for (column_t col_idx = 0; col_idx < payload.ColumnCount(); ++col_idx) {
-				auto &col_vec = row.data[col_idx];
-				DictionaryVector::Child(col_vec).Reference(payload.data[col_idx]);
-				if (col_vec.GetType().InternalType() == PhysicalType::STRUCT) {
-					structs.emplace_back(col_idx);
+			if (!payload_types.empty()) {
+				payload.Initialize(allocator, payload_types);
+				executor.Execute(input, payload);
+
+				// Iterate through them using a single SV
+				payload.Flatten();
+				row.Initialize(allocator, payload_types);
+				row.Slice(sel, 1);
+				// This doesn't work for STRUCTs because the SV
+				// is not copied to the children when you slice
+				for (column_t col_idx = 0; col_idx < payload.ColumnCount(); ++col_idx) {
+					auto &col_vec = row.data[col_idx];
+					DictionaryVector::Child(col_vec).Reference(payload.data[col_idx]);
+					if (col_vec.GetType().InternalType() == PhysicalType::STRUCT) {
+						structs.emplace_back(col_idx);
+					}
 				}
 			}
 
+			// The rows that are filtered out are not aggregated
+			SelectionVector filter_sel;
+			idx_t filtered = count;
+			if (wexpr.filter_expr) {
+				ExpressionExecutor filter_executor(context.client, *wexpr.filter_expr);
+				filter_sel.Initialize(STANDARD_VECTOR_SIZE);
+				filtered = filter_executor.SelectExpression(input, filter_sel);
+			}
+
 			// Update the state and finalize it one row at a time.
+			auto sliding_aggregate = state.sliding_aggregates[expr_idx].get();
+			idx_t filter_idx = 0;
 			for (idx_t i = 0; i < input.size(); ++i) {
 				sel.set_index(0, i);
 				for (const auto struct_idx : structs) {
 					row.data[struct_idx].Slice(payload.data[struct_idx], sel, 1);
 				}
-				// TODO: FILTER and DISTINCT would just skip this.
-				aggregate.update(row.data.data(), aggr_input_data, row.ColumnCount(), statev, 1);
+				bool include_row = true;
+				if (wexpr.filter_expr) {
+					include_row = filter_idx < filtered && filter_sel.get_index(filter_idx) == i;
+					filter_idx += include_row;
+				}
+				if (sliding_aggregate) {
+					sliding_aggregate->Push(row, include_row, result, i);
+					continue;
+				}
+				// TODO: DISTINCT would just skip this.
+				if (include_row) {
+					aggregate.update(row.data.data(), aggr_input_data, row.ColumnCount(), statev, 1);
+				}
 				aggregate.finalize(statev, aggr_input_data, result, 1, i);
 			}
 			break;
@@ -222,6 +558,11 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 			chunk.data[col_idx].Reference(*state.const_vectors[expr_idx]);
 			break;
 		}
+		case ExpressionType::WINDOW_LAG:
+		case ExpressionType::WINDOW_LEAD: {
+			state.lags[expr_idx]->Execute(input, result);
+			break;
+		}
 		case ExpressionType::WINDOW_ROW_NUMBER: {
 			// Set row numbers
 			int64_t start_row = gstate.row_number;
@@ -15,6 +15,8 @@
 #include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
 
 #include <functional>
 
@@ -591,6 +593,40 @@ SinkFinalizeType PhysicalUngroupedAggregate::FinalizeDistinct(Pipeline &pipeline
 	return SinkFinalizeType::READY;
 }
 
+void PhysicalUngroupedAggregate::CombineScanStatistics(GlobalSinkState &gstate_p) const {
+	auto &gstate = gstate_p.Cast<UngroupedAggregateGlobalSinkState>();
+	auto row_count = scan_statistics->GetRowCount();
+	if (row_count == 0) {
+		return;
+	}
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggregate = aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		auto state = gstate.state.aggregates[aggr_idx].get();
+		AggregateInputData aggr_input_data(aggregate.bind_info.get(), gstate.allocator);
+		if (scan_statistics->columns[aggr_idx] == DConstants::INVALID_INDEX) {
+			// COUNT(*) only needs the number of rows
+			aggregate.function.simple_update(nullptr, aggr_input_data, 0, state, row_count);
+		} else {
+			// MIN and MAX only need the minimum and the maximum of the column
+			auto stats = scan_statistics->GetStatistics(aggr_idx);
+			D_ASSERT(stats && NumericStats::HasMinMax(*stats));
+			auto min = NumericStats::Min(*stats);
+			auto max = NumericStats::Max(*stats);
+			if (min > max) {
+				// the statistics are empty: all values are NULL
+				continue;
+			}
+			Vector input(stats->GetType(), 2);
+			input.SetValue(0, min);
+			input.SetValue(1, max);
+			aggregate.function.simple_update(&input, aggr_input_data, 1, state, 2);
+		}
+#ifdef DEBUG
+		gstate.state.counts[aggr_idx] += row_count;
+#endif
+	}
+}
+
 SinkFinalizeType PhysicalUngroupedAggregate::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                                       OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<UngroupedAggregateGlobalSinkState>();
@@ -598,6 +634,9 @@ SinkFinalizeType PhysicalUngroupedAggregate::Finalize(Pipeline &pipeline, Event
 	if (distinct_data) {
 		return FinalizeDistinct(pipeline, event, context, input.global_state);
 	}
+	if (scan_statistics) {
+		CombineScanStatistics(gstate);
+	}
 
 	D_ASSERT(!gstate.finished);
 	gstate.finished = true;
@@ -0,0 +1,209 @@
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+
+#include "duckdb/common/types/bloom_filter.hpp"
+#include "duckdb/common/types/row/tuple_data_collection.hpp"
+#include "duckdb/execution/join_hashtable.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+
+namespace duckdb {
+
+bool JoinFilterPushdownInfo::SupportsMinMaxFilter(const LogicalType &type) {
+	if (type.id() == LogicalTypeId::BOOLEAN || type.id() == LogicalTypeId::ENUM) {
+		return false;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(const PhysicalOperator &op) const {
+	// clear any filters that were pushed by a previous execution of this operator
+	for (auto &target : targets) {
+		target.dynamic_filters->ClearFilters(op);
+	}
+	auto result = make_uniq<JoinFilterGlobalState>();
+	for (auto &type : condition_types) {
+		result->key_stats.push_back(BaseStatistics::CreateEmpty(type));
+	}
+	return result;
+}
+
+unique_ptr<JoinFilterLocalState> JoinFilterPushdownInfo::GetLocalState() const {
+	auto result = make_uniq<JoinFilterLocalState>();
+	for (auto &type : condition_types) {
+		result->key_stats.push_back(BaseStatistics::CreateEmpty(type));
+	}
+	return result;
+}
+
+template <class T>
+static void TemplatedUpdateMinMax(BaseStatistics &stats, Vector &keys, idx_t count) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+
+	T min;
+	T max;
+	bool has_value = false;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		if (!has_value) {
+			min = data[idx];
+			max = data[idx];
+			has_value = true;
+		} else {
+			NumericStats::UpdateValue<T>(data[idx], min, max);
+		}
+	}
+	if (!has_value) {
+		return;
+	}
+	NumericStats::Update<T>(stats, min);
+	NumericStats::Update<T>(stats, max);
+	// we use the "has no null" flag to mark that the statistics contain at least one value
+	stats.SetHasNoNull();
+}
+
+static void UpdateMinMax(BaseStatistics &stats, Vector &keys, idx_t count) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		return TemplatedUpdateMinMax<int8_t>(stats, keys, count);
+	case PhysicalType::INT16:
+		return TemplatedUpdateMinMax<int16_t>(stats, keys, count);
+	case PhysicalType::INT32:
+		return TemplatedUpdateMinMax<int32_t>(stats, keys, count);
+	case PhysicalType::INT64:
+		return TemplatedUpdateMinMax<int64_t>(stats, keys, count);
+	case PhysicalType::INT128:
+		return TemplatedUpdateMinMax<hugeint_t>(stats, keys, count);
+	case PhysicalType::UINT8:
+		return TemplatedUpdateMinMax<uint8_t>(stats, keys, count);
+	case PhysicalType::UINT16:
+		return TemplatedUpdateMinMax<uint16_t>(stats, keys, count);
+	case PhysicalType::UINT32:
+		return TemplatedUpdateMinMax<uint32_t>(stats, keys, count);
+	case PhysicalType::UINT64:
+		return TemplatedUpdateMinMax<uint64_t>(stats, keys, count);
+	case PhysicalType::UINT128:
+		return TemplatedUpdateMinMax<uhugeint_t>(stats, keys, count);
+	case PhysicalType::FLOAT:
+		return TemplatedUpdateMinMax<float>(stats, keys, count);
+	case PhysicalType::DOUBLE:
+		return TemplatedUpdateMinMax<double>(stats, keys, count);
+	default:
+		throw InternalException("Unsupported type for JoinFilterPushdownInfo min/max");
+	}
+}
+
+void JoinFilterPushdownInfo::Sink(DataChunk &join_keys, JoinFilterLocalState &lstate) const {
+	for (idx_t filter_idx = 0; filter_idx < join_condition.size(); filter_idx++) {
+		if (!SupportsMinMaxFilter(condition_types[filter_idx])) {
+			continue;
+		}
+		auto &keys = join_keys.data[join_condition[filter_idx]];
+		UpdateMinMax(lstate.key_stats[filter_idx], keys, join_keys.size());
+	}
+}
+
+void JoinFilterPushdownInfo::Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const {
+	lock_guard<mutex> guard(gstate.lock);
+	for (idx_t filter_idx = 0; filter_idx < join_condition.size(); filter_idx++) {
+		if (!lstate.key_stats[filter_idx].CanHaveNoNull()) {
+			// no keys were seen by this thread
+			continue;
+		}
+		gstate.key_stats[filter_idx].Merge(lstate.key_stats[filter_idx]);
+	}
+}
+
+static vector<BloomFilter> CreateBloomFilters(const JoinFilterPushdownInfo &info, JoinHashTable &ht) {
+	auto &data_collection = ht.GetDataCollection();
+	vector<column_t> column_ids;
+	vector<BloomFilter> result;
+	for (auto &condition_idx : info.join_condition) {
+		column_ids.push_back(condition_idx);
+		result.emplace_back(data_collection.Count());
+	}
+
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, column_ids);
+	DataChunk keys;
+	data_collection.InitializeScanChunk(scan_state, keys);
+	while (data_collection.Scan(scan_state, keys)) {
+		for (idx_t filter_idx = 0; filter_idx < result.size(); filter_idx++) {
+			result[filter_idx].Insert(keys.data[filter_idx], keys.size());
+		}
+	}
+	return result;
+}
+
+void JoinFilterPushdownInfo::PushFilters(const PhysicalOperator &op, JoinFilterGlobalState &gstate,
+                                         optional_ptr<JoinHashTable> ht) const {
+	vector<BloomFilter> bloom_filters;
+	idx_t key_count = 0;
+	if (ht && ht->Count() <= BLOOM_FILTER_MAX_BUILD_COUNT) {
+		bool any_bloom_filter = false;
+		for (auto &target : targets) {
+			any_bloom_filter = any_bloom_filter || target.supports_bloom_filter;
+		}
+		if (any_bloom_filter) {
+			key_count = ht->Count();
+			bloom_filters = CreateBloomFilters(*this, *ht);
+		}
+	}
+
+	for (idx_t filter_idx = 0; filter_idx < join_condition.size(); filter_idx++) {
+		auto condition_idx = join_condition[filter_idx];
+		auto &stats = gstate.key_stats[filter_idx];
+		bool has_min_max = SupportsMinMaxFilter(condition_types[filter_idx]) && stats.CanHaveNoNull() &&
+		                   NumericStats::HasMinMax(stats);
+		for (auto &target : targets) {
+			for (auto &column : target.columns) {
+				if (column.join_condition != condition_idx) {
+					continue;
+				}
+				if (has_min_max) {
+					auto min_val = NumericStats::Min(stats);
+					auto max_val = NumericStats::Max(stats);
+					if (min_val == max_val) {
+						// min and max are equal - we can push an equality filter
+						auto filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val));
+						target.dynamic_filters->PushFilter(op, column.probe_column_index, std::move(filter));
+					} else {
+						auto min_filter =
+						    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val));
+						target.dynamic_filters->PushFilter(op, column.probe_column_index, std::move(min_filter));
+						auto max_filter =
+						    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val));
+						target.dynamic_filters->PushFilter(op, column.probe_column_index, std::move(max_filter));
+					}
+				}
+				if (!bloom_filters.empty() && target.supports_bloom_filter) {
+					auto filter = make_uniq<BloomTableFilter>(bloom_filters[filter_idx], key_count);
+					target.dynamic_filters->PushFilter(op, column.probe_column_index, std::move(filter));
+				}
+			}
+		}
+	}
+}
+
+} // namespace duckdb
@@ -103,6 +103,10 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+
+		if (op.filter_pushdown) {
+			global_filter_state = op.filter_pushdown->GetGlobalState(op);
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
@@ -136,6 +140,9 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+
+	//! Global state for pushing filters on the build-side keys into the probe side (if any)
+	unique_ptr<JoinFilterGlobalState> global_filter_state;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -155,6 +162,10 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+
+		if (op.filter_pushdown) {
+			local_filter_state = op.filter_pushdown->GetLocalState();
+		}
 	}
 
 public:
@@ -168,6 +179,9 @@ public:
 	//! Thread-local HT
 	unique_ptr<JoinHashTable> hash_table;
 
+	//! Thread-local state for pushing filters on the build-side keys into the probe side (if any)
+	unique_ptr<JoinFilterLocalState> local_filter_state;
+
 	//! For updating the temporary memory state
 	idx_t chunk_count;
 	static constexpr const idx_t CHUNK_COUNT_UPDATE_INTERVAL = 60;
@@ -239,6 +253,10 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 	lstate.join_keys.Reset();
 	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
 
+	if (filter_pushdown) {
+		filter_pushdown->Sink(lstate.join_keys, *lstate.local_filter_state);
+	}
+
 	// build the HT
 	auto &ht = *lstate.hash_table;
 	if (payload_types.empty()) {
@@ -275,6 +293,9 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 		lock_guard<mutex> local_ht_lock(gstate.lock);
 		gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
 	}
+	if (filter_pushdown) {
+		filter_pushdown->Combine(*gstate.global_filter_state, *lstate.local_filter_state);
+	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(*this, lstate.join_key_executor, "join_key_executor", 1);
 	client_profiler.Flush(context.thread.profiler);
@@ -486,6 +507,10 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 			sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
 			sink.ScheduleFinalize(pipeline, event);
 		}
+		if (filter_pushdown) {
+			// the hash table is partitioned: we only push the min/max of the keys
+			filter_pushdown->PushFilters(*this, *sink.global_filter_state, nullptr);
+		}
 		sink.finalized = true;
 		return SinkFinalizeType::READY;
 	} else {
@@ -495,6 +520,9 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 		}
 		sink.local_hash_tables.clear();
 		ht.Unpartition();
+		if (filter_pushdown) {
+			filter_pushdown->PushFilters(*this, *sink.global_filter_state, ht);
+		}
 	}
 
 	// check for possible perfect hash table
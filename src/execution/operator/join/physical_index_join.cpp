@@ -0,0 +1,404 @@
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+PhysicalIndexJoin::PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> probe,
+                                     unique_ptr<PhysicalOperator> table_scan, vector<JoinCondition> cond,
+                                     JoinType join_type, vector<idx_t> probe_output_columns_p,
+                                     const vector<idx_t> &table_output_columns, DuckTableEntry &table,
+                                     string index_name_p, bool probe_first, idx_t estimated_cardinality)
+    : PhysicalComparisonJoin(op, PhysicalOperatorType::INDEX_JOIN, std::move(cond), join_type, estimated_cardinality),
+      table(table), index_name(std::move(index_name_p)), probe_output_columns(std::move(probe_output_columns_p)),
+      probe_first(probe_first) {
+	D_ASSERT(join_type == JoinType::INNER || join_type == JoinType::LEFT || join_type == JoinType::SEMI ||
+	         join_type == JoinType::ANTI);
+	children.push_back(std::move(probe));
+	children.push_back(std::move(table_scan));
+
+	auto &scan = children[1]->Cast<PhysicalTableScan>();
+	for (auto &condition : conditions) {
+		D_ASSERT(condition.comparison == ExpressionType::COMPARE_EQUAL);
+		condition_types.push_back(condition.left->return_type);
+
+		// the join key equals the key column of the table, so the filters of the scan can be applied to it
+		auto column_idx = condition.right->Cast<BoundReferenceExpression>().index;
+		auto scan_idx = scan.projection_ids.empty() ? column_idx : scan.projection_ids[column_idx];
+		unique_ptr<TableFilter> key_filter;
+		if (scan.table_filters) {
+			auto entry = scan.table_filters->filters.find(scan_idx);
+			if (entry != scan.table_filters->filters.end()) {
+				key_filter = entry->second->Copy();
+			}
+		}
+		key_filters.push_back(std::move(key_filter));
+	}
+
+	// the output columns of the table scan are fetched from the table
+	for (auto &column_idx : table_output_columns) {
+		auto scan_idx = scan.projection_ids.empty() ? column_idx : scan.projection_ids[column_idx];
+		fetch_ids.push_back(scan.column_ids[scan_idx]);
+		fetch_types.push_back(scan.types[column_idx]);
+	}
+}
+
+string PhysicalIndexJoin::ParamsToString() const {
+	string extra_info = EnumUtil::ToString(join_type) + "\n";
+	for (auto &it : conditions) {
+		string op = ExpressionTypeToOperator(it.comparison);
+		extra_info += it.left->GetName() + " " + op + " " + it.right->GetName() + "\n";
+	}
+	extra_info += "Index: " + index_name + "\n";
+	extra_info += "\n[INFOSEPARATOR]\n";
+	extra_info += StringUtil::Format("EC: %llu\n", estimated_cardinality);
+	return extra_info;
+}
+
+//===--------------------------------------------------------------------===//
+// Planning
+//===--------------------------------------------------------------------===//
+string PhysicalIndexJoin::FindJoinIndex(ClientContext &context, PhysicalOperator &table_scan,
+                                        vector<JoinCondition> &conditions) {
+	if (table_scan.type != PhysicalOperatorType::TABLE_SCAN) {
+		return string();
+	}
+	auto &scan = table_scan.Cast<PhysicalTableScan>();
+	if (scan.function.name != TableScanFunction::GetFunction().name || !scan.bind_data) {
+		return string();
+	}
+	auto &bind_data = scan.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan || bind_data.is_create_index) {
+		return string();
+	}
+
+	// the join keys must be plain columns of the table
+	vector<column_t> key_columns;
+	vector<idx_t> key_scan_indexes;
+	for (auto &condition : conditions) {
+		if (condition.comparison != ExpressionType::COMPARE_EQUAL ||
+		    condition.right->type != ExpressionType::BOUND_REF) {
+			return string();
+		}
+		auto column_idx = condition.right->Cast<BoundReferenceExpression>().index;
+		auto scan_idx = scan.projection_ids.empty() ? column_idx : scan.projection_ids[column_idx];
+		auto column_id = scan.column_ids[scan_idx];
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			return string();
+		}
+		key_columns.push_back(column_id);
+		key_scan_indexes.push_back(scan_idx);
+	}
+	if (scan.table_filters) {
+		// a filter on a key column is applied to the join keys of the probe side instead, the filters on other
+		// columns would have to be applied to the fetched rows
+		for (auto &entry : scan.table_filters->filters) {
+			if (std::find(key_scan_indexes.begin(), key_scan_indexes.end(), entry.first) == key_scan_indexes.end()) {
+				return string();
+			}
+		}
+	}
+
+	auto &storage = bind_data.table.GetStorage();
+	auto &info = *storage.GetDataTableInfo();
+	auto &local_storage = LocalStorage::Get(context, bind_data.table.catalog);
+	auto has_local_storage = local_storage.Find(storage);
+
+	string index_name;
+	vector<idx_t> condition_order;
+	info.GetIndexes().BindAndScan<ART>(context, info, [&](ART &art) {
+		// only unique indexes are maintained for the rows of transaction-local storage
+		if (art.GetConstraintType() == IndexConstraintType::NONE ||
+		    art.unbound_expressions.size() != conditions.size()) {
+			return false;
+		}
+		// every key column of the index must be the right side of exactly one condition
+		vector<idx_t> order;
+		for (auto &expr : art.unbound_expressions) {
+			if (expr->type != ExpressionType::BOUND_COLUMN_REF) {
+				return false;
+			}
+			auto column_id = art.GetColumnIds()[expr->Cast<BoundColumnRefExpression>().binding.column_index];
+			auto entry = std::find(key_columns.begin(), key_columns.end(), column_id);
+			if (entry == key_columns.end()) {
+				return false;
+			}
+			auto condition_idx = NumericCast<idx_t>(entry - key_columns.begin());
+			if (std::find(order.begin(), order.end(), condition_idx) != order.end()) {
+				return false;
+			}
+			order.push_back(condition_idx);
+		}
+		if (has_local_storage) {
+			bool has_local_index = false;
+			local_storage.GetIndexes(storage).ScanBound<ART>([&](ART &local_art) {
+				has_local_index = local_art.GetIndexName() == art.GetIndexName();
+				return has_local_index;
+			});
+			if (!has_local_index) {
+				return false;
+			}
+		}
+		index_name = art.GetIndexName();
+		condition_order = std::move(order);
+		return true;
+	});
+	if (index_name.empty()) {
+		return string();
+	}
+
+	// reorder the conditions to match the key columns of the index
+	vector<JoinCondition> ordered_conditions;
+	for (auto &condition_idx : condition_order) {
+		ordered_conditions.push_back(std::move(conditions[condition_idx]));
+	}
+	conditions = std::move(ordered_conditions);
+	return index_name;
+}
+
+//===--------------------------------------------------------------------===//
+// Operator
+//===--------------------------------------------------------------------===//
+class IndexJoinOperatorState : public CachingOperatorState {
+public:
+	IndexJoinOperatorState(ClientContext &context, const PhysicalIndexJoin &op)
+	    : transaction(DuckTransaction::Get(context, op.table.catalog)), probe_executor(context),
+	      arena_allocator(BufferAllocator::Get(context)), keys(STANDARD_VECTOR_SIZE), local_match_offset(0),
+	      match_offset(0), probed(false), fetch_sel(STANDARD_VECTOR_SIZE) {
+		auto &allocator = Allocator::Get(context);
+		join_keys.Initialize(allocator, op.condition_types);
+		for (auto &cond : op.conditions) {
+			probe_executor.AddExpression(*cond.left);
+		}
+		if (!op.fetch_types.empty()) {
+			fetch_chunk.Initialize(allocator, op.fetch_types);
+		}
+
+		// find the index of the table, and the index of the transaction-local storage
+		auto &storage = op.table.GetStorage();
+		auto &info = *storage.GetDataTableInfo();
+		info.GetIndexes().BindAndScan<ART>(context, info, [&](ART &art) {
+			if (art.GetIndexName() == op.index_name) {
+				index = &art;
+				return true;
+			}
+			return false;
+		});
+		if (!index) {
+			throw InternalException("Index \"%s\" of the index join was not found", op.index_name);
+		}
+		auto &local_storage = LocalStorage::Get(transaction);
+		if (local_storage.Find(storage)) {
+			local_storage.GetIndexes(storage).ScanBound<ART>([&](ART &art) {
+				if (art.GetIndexName() == op.index_name) {
+					local_index = &art;
+					return true;
+				}
+				return false;
+			});
+		}
+	}
+
+	DuckTransaction &transaction;
+	optional_ptr<ART> index;
+	optional_ptr<ART> local_index;
+
+	ExpressionExecutor probe_executor;
+	DataChunk join_keys;
+	ArenaAllocator arena_allocator;
+	vector<ARTKey> keys;
+
+	//! The row IDs that match the keys of the current input chunk, and the input row of each match
+	vector<row_t> match_row_ids;
+	vector<sel_t> match_input_rows;
+	//! The matches starting at this offset are rows of the transaction-local storage
+	idx_t local_match_offset;
+	//! The next match to fetch
+	idx_t match_offset;
+	//! Whether the current input chunk was probed
+	bool probed;
+	//! Whether an input row has a match that is visible to the transaction
+	bool found_match[STANDARD_VECTOR_SIZE];
+
+	DataChunk fetch_chunk;
+	ColumnFetchState fetch_state;
+	SelectionVector fetch_sel;
+
+public:
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op, probe_executor, "probe_executor", 0);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalIndexJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<IndexJoinOperatorState>(context.client, *this);
+}
+
+static void ProbeIndex(const PhysicalIndexJoin &op, DataChunk &input, IndexJoinOperatorState &state) {
+	state.join_keys.Reset();
+	state.probe_executor.Execute(input, state.join_keys);
+	state.arena_allocator.Reset();
+	ART::GenerateKeys(state.arena_allocator, state.join_keys, state.keys);
+
+	// the keys that do not pass the filters of the table scan have no match, they are not looked up
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t approved_count = input.size();
+	bool has_filters = false;
+	for (idx_t i = 0; i < op.key_filters.size(); i++) {
+		if (!op.key_filters[i]) {
+			continue;
+		}
+		if (!has_filters) {
+			for (idx_t row_idx = 0; row_idx < input.size(); row_idx++) {
+				sel.set_index(row_idx, row_idx);
+			}
+			has_filters = true;
+		}
+		UnifiedVectorFormat vdata;
+		state.join_keys.data[i].ToUnifiedFormat(input.size(), vdata);
+		ColumnSegment::FilterSelection(sel, state.join_keys.data[i], vdata, *op.key_filters[i], input.size(),
+		                               approved_count);
+	}
+	if (has_filters) {
+		bool approved[STANDARD_VECTOR_SIZE];
+		memset(approved, 0, sizeof(approved));
+		for (idx_t i = 0; i < approved_count; i++) {
+			approved[sel.get_index(i)] = true;
+		}
+		for (idx_t i = 0; i < input.size(); i++) {
+			if (!approved[i]) {
+				state.keys[i] = ARTKey();
+			}
+		}
+	}
+
+	state.match_row_ids.clear();
+	state.match_input_rows.clear();
+	state.index->SearchEqual(state.keys, input.size(), state.match_row_ids, state.match_input_rows);
+	state.local_match_offset = state.match_row_ids.size();
+	if (state.local_index) {
+		state.local_index->SearchEqual(state.keys, input.size(), state.match_row_ids, state.match_input_rows);
+	}
+	state.match_offset = 0;
+	memset(state.found_match, 0, sizeof(state.found_match));
+}
+
+OperatorResultType PhysicalIndexJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                      GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<IndexJoinOperatorState>();
+	if (!state.probed) {
+		ProbeIndex(*this, input, state);
+		state.probed = true;
+	}
+
+	auto &storage = table.GetStorage();
+	auto probe_offset = probe_first ? 0 : fetch_ids.size();
+	auto fetch_offset = probe_first ? probe_output_columns.size() : 0;
+	while (state.match_offset < state.match_row_ids.size()) {
+		// fetch the matches in batches, the rows of the table and of the transaction-local storage are fetched
+		// separately
+		auto is_local = state.match_offset >= state.local_match_offset;
+		auto batch_end = is_local ? state.match_row_ids.size() : state.local_match_offset;
+		batch_end = MinValue<idx_t>(batch_end, state.match_offset + STANDARD_VECTOR_SIZE);
+		auto batch_count = batch_end - state.match_offset;
+
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(state.match_row_ids.data() + state.match_offset));
+		state.fetch_chunk.Reset();
+		if (is_local) {
+			LocalStorage::Get(state.transaction)
+			    .FetchChunk(storage, row_ids, batch_count, fetch_ids, state.fetch_chunk, state.fetch_state,
+			                &state.fetch_sel);
+		} else {
+			storage.Fetch(state.transaction, state.fetch_chunk, fetch_ids, row_ids, batch_count, state.fetch_state,
+			              &state.fetch_sel);
+		}
+
+		// rows that are not visible to the transaction are skipped by the fetch
+		auto fetch_count = state.fetch_chunk.size();
+		SelectionVector input_sel(STANDARD_VECTOR_SIZE);
+		for (idx_t i = 0; i < fetch_count; i++) {
+			auto input_row = state.match_input_rows[state.match_offset + state.fetch_sel.get_index(i)];
+			input_sel.set_index(i, input_row);
+			state.found_match[input_row] = true;
+		}
+		state.match_offset = batch_end;
+		if (fetch_count == 0 || join_type == JoinType::SEMI || join_type == JoinType::ANTI) {
+			continue;
+		}
+
+		for (idx_t i = 0; i < probe_output_columns.size(); i++) {
+			chunk.data[probe_offset + i].Slice(input.data[probe_output_columns[i]], input_sel, fetch_count);
+		}
+		for (idx_t i = 0; i < fetch_ids.size(); i++) {
+			chunk.data[fetch_offset + i].Reference(state.fetch_chunk.data[i]);
+		}
+		chunk.SetCardinality(fetch_count);
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+
+	// all matches of this input chunk were fetched
+	state.probed = false;
+	switch (join_type) {
+	case JoinType::SEMI:
+	case JoinType::ANTI: {
+		DataChunk probe_chunk;
+		probe_chunk.InitializeEmpty(chunk.GetTypes());
+		probe_chunk.ReferenceColumns(input, probe_output_columns);
+		if (join_type == JoinType::SEMI) {
+			ConstructSemiJoinResult(probe_chunk, chunk, state.found_match);
+		} else {
+			ConstructAntiJoinResult(probe_chunk, chunk, state.found_match);
+		}
+		break;
+	}
+	case JoinType::LEFT: {
+		// output the input rows without a match, with NULL values for the columns of the table
+		SelectionVector input_sel(STANDARD_VECTOR_SIZE);
+		idx_t remaining_count = 0;
+		for (idx_t i = 0; i < input.size(); i++) {
+			if (!state.found_match[i]) {
+				input_sel.set_index(remaining_count++, i);
+			}
+		}
+		if (remaining_count > 0) {
+			for (idx_t i = 0; i < probe_output_columns.size(); i++) {
+				chunk.data[probe_offset + i].Slice(input.data[probe_output_columns[i]], input_sel, remaining_count);
+			}
+			for (idx_t i = 0; i < fetch_ids.size(); i++) {
+				auto &result_vector = chunk.data[fetch_offset + i];
+				result_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
+				ConstantVector::SetNull(result_vector, true);
+			}
+		}
+		chunk.SetCardinality(remaining_count);
+		break;
+	}
+	default:
+		break;
+	}
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+//===--------------------------------------------------------------------===//
+// Pipeline Construction
+//===--------------------------------------------------------------------===//
+void PhysicalIndexJoin::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
+	// the table is probed through the index, so only the probe side is executed
+	PhysicalJoin::BuildJoinPipelines(current, meta_pipeline, *this, false);
+}
+
+} // namespace duckdb
@@ -3,23 +3,29 @@
 #include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/execution/index/art/art_key.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/executor_task.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 
+#include <numeric>
+
 namespace duckdb {
 
 PhysicalCreateARTIndex::PhysicalCreateARTIndex(LogicalOperator &op, TableCatalogEntry &table_p,
                                                const vector<column_t> &column_ids, unique_ptr<CreateIndexInfo> info,
                                                vector<unique_ptr<Expression>> unbound_expressions,
-                                               idx_t estimated_cardinality, const bool sorted)
+                                               idx_t estimated_cardinality)
     : PhysicalOperator(PhysicalOperatorType::CREATE_INDEX, op.types, estimated_cardinality),
-      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)), unbound_expressions(std::move(unbound_expressions)),
-      sorted(sorted) {
+      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)),
+      unbound_expressions(std::move(unbound_expressions)) {
 
 	// convert virtual column ids to storage column ids
 	for (auto &column_id : column_ids) {
@@ -31,45 +37,85 @@ PhysicalCreateARTIndex::PhysicalCreateARTIndex(LogicalOperator &op, TableCatalog
 // Sink
 //===--------------------------------------------------------------------===//
 
+//! The sorted keys and row IDs of the input of one thread
+struct CreateARTIndexSortedRun {
+	//! Holds the data of the keys
+	unique_ptr<ArenaAllocator> arena_allocator;
+	vector<ARTKey> keys;
+	vector<row_t> row_ids;
+};
+
 class CreateARTIndexGlobalSinkState : public GlobalSinkState {
 public:
+	CreateARTIndexGlobalSinkState() : total_count(0), built_count(0), prepared_count(0) {
+	}
+
 	//! Global index to be added to the table
 	unique_ptr<BoundIndex> global_index;
+
+	mutex lock;
+	//! The sorted runs of all threads
+	vector<CreateARTIndexSortedRun> runs;
+	//! The upper bounds of the key ranges, range i holds the keys in [bounds[i - 1], bounds[i]). The first and the
+	//! last range are unbounded
+	vector<ARTKey> bounds;
+	//! The ART of each key range
+	vector<unique_ptr<BoundIndex>> range_indexes;
+	//! The number of keys of each range
+	vector<idx_t> range_counts;
+	//! The buffer counts by which the buffer IDs of each range ART are incremented before the merge
+	vector<ARTFlags> range_flags;
+
+	//! The total number of keys, set in Finalize
+	atomic<idx_t> total_count;
+	//! The number of keys inserted into the range ARTs
+	atomic<idx_t> built_count;
+	//! The number of keys of range ARTs whose buffer IDs were incremented
+	atomic<idx_t> prepared_count;
 };
 
 class CreateARTIndexLocalSinkState : public LocalSinkState {
 public:
-	explicit CreateARTIndexLocalSinkState(ClientContext &context) : arena_allocator(Allocator::Get(context)) {};
+	explicit CreateARTIndexLocalSinkState(ClientContext &context)
+	    : arena_allocator(make_uniq<ArenaAllocator>(Allocator::Get(context))) {};
 
-	unique_ptr<BoundIndex> local_index;
-	ArenaAllocator arena_allocator;
+	//! Holds the data of all collected keys
+	unique_ptr<ArenaAllocator> arena_allocator;
 	vector<ARTKey> keys;
 	DataChunk key_chunk;
 	vector<column_t> key_column_ids;
+
+	//! The keys of the input chunks of this thread
+	vector<ARTKey> collected_keys;
+	//! The row IDs of the collected keys
+	vector<row_t> collected_row_ids;
+	//! The ART of the keys that were collected before the last MAX_COLLECTED_KEY_MEMORY was exceeded (if any)
+	unique_ptr<BoundIndex> local_index;
 };
 
+static unique_ptr<BoundIndex> CreateART(const PhysicalCreateARTIndex &op) {
+	auto &storage = op.table.GetStorage();
+	return make_uniq<ART>(op.info->index_name, op.info->constraint_type, op.storage_ids, TableIOManager::Get(storage),
+	                      op.unbound_expressions, storage.db);
+}
+
 unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientContext &context) const {
 	auto state = make_uniq<CreateARTIndexGlobalSinkState>();
 
 	// create the global index
-	auto &storage = table.GetStorage();
-	state->global_index = make_uniq<ART>(info->index_name, info->constraint_type, storage_ids,
-	                                     TableIOManager::Get(storage), unbound_expressions, storage.db);
-
+	state->global_index = CreateART(*this);
 	return (std::move(state));
 }
 
 unique_ptr<LocalSinkState> PhysicalCreateARTIndex::GetLocalSinkState(ExecutionContext &context) const {
 	auto state = make_uniq<CreateARTIndexLocalSinkState>(context.client);
 
-	// create the local index
-
-	auto &storage = table.GetStorage();
-	state->local_index = make_uniq<ART>(info->index_name, info->constraint_type, storage_ids,
-	                                    TableIOManager::Get(storage), unbound_expressions, storage.db);
-
 	state->keys = vector<ARTKey>(STANDARD_VECTOR_SIZE);
-	state->key_chunk.Initialize(Allocator::Get(context.client), state->local_index->logical_types);
+	vector<LogicalType> key_types;
+	for (auto &expr : unbound_expressions) {
+		key_types.push_back(expr->return_type);
+	}
+	state->key_chunk.Initialize(Allocator::Get(context.client), key_types);
 
 	for (idx_t i = 0; i < state->key_chunk.ColumnCount(); i++) {
 		state->key_column_ids.push_back(i);
@@ -77,46 +123,50 @@ unique_ptr<LocalSinkState> PhysicalCreateARTIndex::GetLocalSinkState(ExecutionCo
 	return std::move(state);
 }
 
-SinkResultType PhysicalCreateARTIndex::SinkUnsorted(Vector &row_identifiers, OperatorSinkInput &input) const {
-
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	auto count = l_state.key_chunk.size();
-
-	// get the corresponding row IDs
-	row_identifiers.Flatten(count);
-	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+static bool KeyLessThan(const ARTKey &l_key, const ARTKey &r_key) {
+	return r_key > l_key;
+}
 
-	// insert the row IDs
-	auto &art = l_state.local_index->Cast<ART>();
+static CreateARTIndexSortedRun SortCollectedKeys(CreateARTIndexLocalSinkState &lstate) {
+	auto count = lstate.collected_keys.size();
+	vector<idx_t> order(count);
+	std::iota(order.begin(), order.end(), 0);
+	auto &keys = lstate.collected_keys;
+	std::sort(order.begin(), order.end(),
+	          [&](const idx_t l_idx, const idx_t r_idx) { return KeyLessThan(keys[l_idx], keys[r_idx]); });
+
+	CreateARTIndexSortedRun run;
+	run.keys.resize(count);
+	run.row_ids.resize(count);
 	for (idx_t i = 0; i < count; i++) {
-		if (!art.Insert(art.tree, l_state.keys[i], 0, row_ids[i])) {
-			throw ConstraintException("Data contains duplicates on indexed column(s)");
-		}
+		run.keys[i] = keys[order[i]];
+		run.row_ids[i] = lstate.collected_row_ids[order[i]];
 	}
-
-	return SinkResultType::NEED_MORE_INPUT;
+	vector<ARTKey>().swap(lstate.collected_keys);
+	vector<row_t>().swap(lstate.collected_row_ids);
+	run.arena_allocator = std::move(lstate.arena_allocator);
+	return run;
 }
 
-SinkResultType PhysicalCreateARTIndex::SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const {
-
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	auto &storage = table.GetStorage();
-	auto &l_index = l_state.local_index;
+static void BuildLocalIndex(const PhysicalCreateARTIndex &op, CreateARTIndexLocalSinkState &lstate) {
+	auto count = lstate.collected_keys.size();
+	auto run = SortCollectedKeys(lstate);
 
-	// create an ART from the chunk
-	auto art = make_uniq<ART>(info->index_name, l_index->GetConstraintType(), l_index->GetColumnIds(),
-	                          l_index->table_io_manager, l_index->unbound_expressions, storage.db,
-	                          l_index->Cast<ART>().allocators);
-	if (!art->ConstructFromSorted(l_state.key_chunk.size(), l_state.keys, row_identifiers)) {
+	// build an ART bottom-up from the sorted keys, and merge it into the thread-local ART
+	auto art = CreateART(op);
+	Vector row_identifiers(LogicalType::ROW_TYPE, data_ptr_cast(run.row_ids.data()));
+	if (!art->Cast<ART>().ConstructFromSorted(count, run.keys, row_identifiers)) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
-
-	// merge into the local ART
-	if (!l_index->MergeIndexes(*art)) {
+	if (!lstate.local_index) {
+		lstate.local_index = std::move(art);
+	} else if (!lstate.local_index->MergeIndexes(*art)) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
 
-	return SinkResultType::NEED_MORE_INPUT;
+	// the ART holds copies of the keys, the arena is reused for the next keys
+	lstate.arena_allocator = std::move(run.arena_allocator);
+	lstate.arena_allocator->Reset();
 }
 
 SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk &chunk,
@@ -124,18 +174,27 @@ SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk
 
 	D_ASSERT(chunk.ColumnCount() >= 2);
 
-	// generate the keys for the given input
+	// generate the keys for the given input, their data remains in the arena until the ART is built
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
-	l_state.arena_allocator.Reset();
-	ART::GenerateKeys(l_state.arena_allocator, l_state.key_chunk, l_state.keys);
+	ART::GenerateKeys(*l_state.arena_allocator, l_state.key_chunk, l_state.keys);
 
-	// insert the keys and their corresponding row IDs
+	// collect the keys and their corresponding row IDs
+	auto count = l_state.key_chunk.size();
 	auto &row_identifiers = chunk.data[chunk.ColumnCount() - 1];
-	if (sorted) {
-		return SinkSorted(row_identifiers, input);
+	row_identifiers.Flatten(count);
+	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+
+	l_state.collected_keys.insert(l_state.collected_keys.end(), l_state.keys.begin(), l_state.keys.begin() + count);
+	l_state.collected_row_ids.insert(l_state.collected_row_ids.end(), row_ids, row_ids + count);
+
+	auto collected_memory = l_state.arena_allocator->SizeInBytes() +
+	                        l_state.collected_keys.size() * (sizeof(ARTKey) + sizeof(row_t));
+	if (collected_memory > MAX_COLLECTED_KEY_MEMORY) {
+		// the keys of a large table are not kept until Finalize
+		BuildLocalIndex(*this, l_state);
 	}
-	return SinkUnsorted(row_identifiers, input);
+	return SinkResultType::NEED_MORE_INPUT;
 }
 
 SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
@@ -144,19 +203,264 @@ SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
 	auto &gstate = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &lstate = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 
-	// merge the local index into the global index
-	if (!gstate.global_index->MergeIndexes(*lstate.local_index)) {
+	// the thread-local ART of the keys that were built while sinking is merged into the global ART right away
+	if (lstate.local_index && !gstate.global_index->MergeIndexes(*lstate.local_index)) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
+	lstate.local_index.reset();
+
+	if (lstate.collected_keys.empty()) {
+		return SinkCombineResultType::FINISHED;
+	}
+	auto run = SortCollectedKeys(lstate);
 
+	// the ARTs are built from the sorted runs of all threads in Finalize
+	lock_guard<mutex> guard(gstate.lock);
+	gstate.runs.push_back(std::move(run));
 	return SinkCombineResultType::FINISHED;
 }
 
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+
+//! Builds the ART of one key range from the slices of all sorted runs that fall into the range
+class CreateARTIndexBuildTask : public ExecutorTask {
+public:
+	CreateARTIndexBuildTask(shared_ptr<Event> event_p, ClientContext &context, CreateARTIndexGlobalSinkState &gstate,
+	                        idx_t range_idx)
+	    : ExecutorTask(context, std::move(event_p)), gstate(gstate), range_idx(range_idx) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		auto &bounds = gstate.bounds;
+		optional_ptr<ARTKey> lower = range_idx == 0 ? nullptr : &bounds[range_idx - 1];
+		optional_ptr<ARTKey> upper = range_idx == bounds.size() ? nullptr : &bounds[range_idx];
+
+		// gather the sorted slices of the runs, and merge them
+		vector<pair<ARTKey, row_t>> entries;
+		vector<idx_t> slice_ends;
+		for (auto &run : gstate.runs) {
+			auto begin = run.keys.begin();
+			auto end = run.keys.end();
+			if (lower) {
+				begin = std::lower_bound(run.keys.begin(), run.keys.end(), *lower, KeyLessThan);
+			}
+			if (upper) {
+				end = std::lower_bound(begin, run.keys.end(), *upper, KeyLessThan);
+			}
+			for (auto it = begin; it != end; it++) {
+				entries.emplace_back(*it, run.row_ids[NumericCast<idx_t>(it - run.keys.begin())]);
+			}
+			slice_ends.push_back(entries.size());
+		}
+		auto entry_less_than = [](const pair<ARTKey, row_t> &l, const pair<ARTKey, row_t> &r) {
+			return KeyLessThan(l.first, r.first);
+		};
+		for (idx_t i = 1; i < slice_ends.size(); i++) {
+			std::inplace_merge(entries.begin(), entries.begin() + NumericCast<int64_t>(slice_ends[i - 1]),
+			                   entries.begin() + NumericCast<int64_t>(slice_ends[i]), entry_less_than);
+		}
+
+		// build the ART of the range bottom-up from the sorted keys
+		auto count = entries.size();
+		if (count != 0) {
+			vector<ARTKey> keys(count);
+			vector<row_t> row_ids(count);
+			for (idx_t i = 0; i < count; i++) {
+				keys[i] = entries[i].first;
+				row_ids[i] = entries[i].second;
+			}
+			Vector row_identifiers(LogicalType::ROW_TYPE, data_ptr_cast(row_ids.data()));
+			auto &art = gstate.range_indexes[range_idx]->Cast<ART>();
+			if (!art.ConstructFromSorted(count, keys, row_identifiers)) {
+				throw ConstraintException("Data contains duplicates on indexed column(s)");
+			}
+		}
+		gstate.range_counts[range_idx] = count;
+		gstate.built_count += count;
+
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	CreateARTIndexGlobalSinkState &gstate;
+	idx_t range_idx;
+};
+
+//! Increments the buffer IDs of a range ART, so that it can be merged into the global ART without another traversal
+class CreateARTIndexPrepareMergeTask : public ExecutorTask {
+public:
+	CreateARTIndexPrepareMergeTask(shared_ptr<Event> event_p, ClientContext &context,
+	                               CreateARTIndexGlobalSinkState &gstate, idx_t range_idx)
+	    : ExecutorTask(context, std::move(event_p)), gstate(gstate), range_idx(range_idx) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		gstate.range_indexes[range_idx]->Cast<ART>().PrepareMerge(gstate.range_flags[range_idx]);
+		gstate.prepared_count += gstate.range_counts[range_idx];
+
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	CreateARTIndexGlobalSinkState &gstate;
+	idx_t range_idx;
+};
+
+class CreateARTIndexPrepareMergeEvent : public BasePipelineEvent {
+public:
+	CreateARTIndexPrepareMergeEvent(const PhysicalCreateARTIndex &op_p, CreateARTIndexGlobalSinkState &gstate_p,
+	                                Pipeline &pipeline_p, vector<idx_t> ranges_p)
+	    : BasePipelineEvent(pipeline_p), op(op_p), gstate(gstate_p), ranges(std::move(ranges_p)) {
+	}
+
+	const PhysicalCreateARTIndex &op;
+	CreateARTIndexGlobalSinkState &gstate;
+	//! The range ARTs that must be prepared
+	vector<idx_t> ranges;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+		vector<shared_ptr<Task>> tasks;
+		for (auto &range_idx : ranges) {
+			tasks.push_back(make_uniq<CreateARTIndexPrepareMergeTask>(shared_from_this(), context, gstate, range_idx));
+		}
+		SetTasks(std::move(tasks));
+	}
+
+	void FinishEvent() override {
+		op.FinishIndex(pipeline->GetClientContext(), gstate);
+	}
+};
+
+class CreateARTIndexBuildEvent : public BasePipelineEvent {
+public:
+	CreateARTIndexBuildEvent(const PhysicalCreateARTIndex &op_p, CreateARTIndexGlobalSinkState &gstate_p,
+	                         Pipeline &pipeline_p)
+	    : BasePipelineEvent(pipeline_p), op(op_p), gstate(gstate_p) {
+	}
+
+	const PhysicalCreateARTIndex &op;
+	CreateARTIndexGlobalSinkState &gstate;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+		vector<shared_ptr<Task>> tasks;
+		for (idx_t range_idx = 0; range_idx < gstate.range_indexes.size(); range_idx++) {
+			tasks.push_back(make_uniq<CreateARTIndexBuildTask>(shared_from_this(), context, gstate, range_idx));
+		}
+		SetTasks(std::move(tasks));
+	}
+
+	void FinishEvent() override {
+		// the keys of the runs are no longer needed, but their data is, until the ARTs are merged
+		for (auto &run : gstate.runs) {
+			vector<ARTKey>().swap(run.keys);
+			vector<row_t>().swap(run.row_ids);
+		}
+
+		// the buffer IDs of each range ART are incremented by the buffer counts of the global ART and of all range
+		// ARTs that are merged before it
+		ARTFlags offsets;
+		gstate.global_index->Cast<ART>().InitializeMerge(offsets);
+
+		vector<idx_t> ranges_to_prepare;
+		gstate.range_flags.resize(gstate.range_indexes.size());
+		for (idx_t range_idx = 0; range_idx < gstate.range_indexes.size(); range_idx++) {
+			auto &art = gstate.range_indexes[range_idx]->Cast<ART>();
+			ARTFlags buffer_counts;
+			art.InitializeMerge(buffer_counts);
+
+			bool has_offset = false;
+			for (idx_t i = 0; i < buffer_counts.merge_buffer_counts.size(); i++) {
+				has_offset = has_offset || offsets.merge_buffer_counts[i] != 0;
+				gstate.range_flags[range_idx].merge_buffer_counts.push_back(offsets.merge_buffer_counts[i]);
+				offsets.merge_buffer_counts[i] += buffer_counts.merge_buffer_counts[i];
+			}
+			if (has_offset && art.tree.HasMetadata()) {
+				ranges_to_prepare.push_back(range_idx);
+			} else {
+				gstate.prepared_count += gstate.range_counts[range_idx];
+			}
+		}
+
+		if (ranges_to_prepare.empty()) {
+			op.FinishIndex(pipeline->GetClientContext(), gstate);
+			return;
+		}
+		auto new_event = make_shared_ptr<CreateARTIndexPrepareMergeEvent>(op, gstate, *pipeline,
+		                                                                  std::move(ranges_to_prepare));
+		InsertEvent(std::move(new_event));
+	}
+};
+
 SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                                   OperatorSinkFinalizeInput &input) const {
 
-	// here, we set the resulting global index as the newly created index of the table
 	auto &state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
+	idx_t total_count = 0;
+	for (auto &run : state.runs) {
+		total_count += run.keys.size();
+	}
+	if (total_count == 0) {
+		FinishIndex(context, state);
+		return SinkFinalizeType::READY;
+	}
+
+	// split the key space into ranges of similar size, which are sampled from the sorted runs
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	auto num_threads = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	auto range_count = MinValue(num_threads * RANGES_PER_THREAD, total_count / MIN_KEYS_PER_RANGE);
+	if (range_count > 1) {
+		vector<ARTKey> samples;
+		auto sample_count = range_count * SAMPLES_PER_RANGE;
+		for (auto &run : state.runs) {
+			auto run_sample_count = MaxValue<idx_t>(1, run.keys.size() * sample_count / total_count);
+			for (idx_t i = 0; i < run_sample_count; i++) {
+				samples.push_back(run.keys[i * run.keys.size() / run_sample_count]);
+			}
+		}
+		std::sort(samples.begin(), samples.end(), KeyLessThan);
+
+		// equal keys are always in the same range
+		for (idx_t i = 1; i < range_count; i++) {
+			auto &bound = samples[i * samples.size() / range_count];
+			if (state.bounds.empty() || KeyLessThan(state.bounds.back(), bound)) {
+				state.bounds.push_back(bound);
+			}
+		}
+	}
+
+	for (idx_t range_idx = 0; range_idx <= state.bounds.size(); range_idx++) {
+		state.range_indexes.push_back(CreateART(*this));
+	}
+	state.range_counts.resize(state.range_indexes.size());
+	state.total_count = total_count;
+
+	auto new_event = make_shared_ptr<CreateARTIndexBuildEvent>(*this, state, pipeline);
+	event.InsertEvent(std::move(new_event));
+	return SinkFinalizeType::READY;
+}
+
+void PhysicalCreateARTIndex::FinishIndex(ClientContext &context, GlobalSinkState &gstate) const {
+
+	auto &state = gstate.Cast<CreateARTIndexGlobalSinkState>();
+
+	// merge the range ARTs in the order in which their buffer IDs were incremented
+	vector<reference<ART>> range_arts;
+	for (auto &range_index : state.range_indexes) {
+		range_arts.push_back(range_index->Cast<ART>());
+	}
+	if (!state.global_index->Cast<ART>().MergePreparedIndexes(range_arts)) {
+		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	}
+	state.range_indexes.clear();
+	state.runs.clear();
 
 	// vacuum excess memory and verify
 	state.global_index->Vacuum();
@@ -173,7 +477,7 @@ SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &eve
 	if (!index_entry) {
 		D_ASSERT(info->on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT);
 		// index already exists, but error ignored because of IF NOT EXISTS
-		return SinkFinalizeType::READY;
+		return;
 	}
 	auto &index = index_entry->Cast<DuckIndexEntry>();
 	index.initial_index_size = state.global_index->GetInMemorySize();
@@ -185,7 +489,18 @@ SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &eve
 
 	// add index to storage
 	storage.AddIndex(std::move(state.global_index));
-	return SinkFinalizeType::READY;
+}
+
+double PhysicalCreateARTIndex::GetSinkProgress(ClientContext &context, GlobalSinkState &gstate,
+                                               double source_progress) const {
+	// scanning the table is the first half of the work, building and merging the range ARTs is the second half
+	auto &state = gstate.Cast<CreateARTIndexGlobalSinkState>();
+	auto total_count = state.total_count.load();
+	if (total_count == 0) {
+		return source_progress / 2;
+	}
+	auto done_count = state.built_count.load() + state.prepared_count.load();
+	return 50 + 50 * static_cast<double>(done_count) / static_cast<double>(2 * total_count);
 }
 
 //===--------------------------------------------------------------------===//
@@ -197,4 +512,9 @@ SourceResultType PhysicalCreateARTIndex::GetData(ExecutionContext &context, Data
 	return SourceResultType::FINISHED;
 }
 
+double PhysicalCreateARTIndex::GetProgress(ClientContext &context, GlobalSourceState &gstate) const {
+	// the index is complete once the source is executed
+	return 100;
+}
+
 } // namespace duckdb
@@ -119,6 +119,11 @@ unique_ptr<GlobalSinkState> PhysicalOperator::GetGlobalSinkState(ClientContext &
 	return make_uniq<GlobalSinkState>();
 }
 
+double PhysicalOperator::GetSinkProgress(ClientContext &context, GlobalSinkState &gstate,
+                                         double source_progress) const {
+	return source_progress;
+}
+
 idx_t PhysicalOperator::GetMaxThreadMemory(ClientContext &context) {
 	// Memory usage per thread should scale with max mem / num threads
 	// We take 1/4th of this, to be conservative
@@ -4,13 +4,16 @@
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/function_binder.hpp"
+#include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
 
 namespace duckdb {
 
@@ -59,6 +62,7 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 		if (!stats) {
 			// no stats, but we might still be able to use perfect hashing if the type is small enough
 			// for small types we can just set the stats to [type_min, type_max]
+			// the values of ENUMs are indexes into their dictionary, so their range is the size of the dictionary
 			switch (group_type.InternalType()) {
 			case PhysicalType::INT8:
 			case PhysicalType::INT16:
@@ -66,6 +70,9 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 			case PhysicalType::UINT16:
 				break;
 			default:
+				if (group_type.id() == LogicalTypeId::ENUM) {
+					break;
+				}
 				// type is too large and there are no stats: skip perfect hashing
 				return false;
 			}
@@ -149,6 +156,68 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+static void PushAggregatesIntoTableScan(PhysicalUngroupedAggregate &aggregate, PhysicalOperator &child) {
+	// the input of the aggregates is either the table scan, or a projection of its columns
+	optional_ptr<PhysicalProjection> projection;
+	reference<PhysicalOperator> scan_op(child);
+	if (child.type == PhysicalOperatorType::PROJECTION) {
+		projection = child.Cast<PhysicalProjection>();
+		scan_op = *child.children[0];
+	}
+	if (scan_op.get().type != PhysicalOperatorType::TABLE_SCAN) {
+		return;
+	}
+	auto &scan = scan_op.get().Cast<PhysicalTableScan>();
+	if (scan.function.name != "seq_scan" || !scan.bind_data) {
+		return;
+	}
+	auto &bind_data = scan.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan || bind_data.is_create_index || bind_data.aggregate_statistics) {
+		return;
+	}
+	// every aggregate has to be computable from the statistics of the row groups: MIN/MAX of a column or COUNT(*)
+	vector<idx_t> columns;
+	for (auto &expr : aggregate.aggregates) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		if (aggr.IsDistinct() || aggr.filter || aggr.order_bys) {
+			return;
+		}
+		if (aggr.function.name == "count_star") {
+			columns.push_back(DConstants::INVALID_INDEX);
+			continue;
+		}
+		if ((aggr.function.name != "min" && aggr.function.name != "max") || aggr.children.size() != 1 ||
+		    aggr.children[0]->type != ExpressionType::BOUND_REF) {
+			return;
+		}
+		// the statistics of floating point columns do not order NaN like MIN/MAX
+		auto &type = aggr.children[0]->return_type;
+		if (BaseStatistics::GetStatsType(type) != StatisticsType::NUMERIC_STATS ||
+		    type.InternalType() == PhysicalType::FLOAT || type.InternalType() == PhysicalType::DOUBLE) {
+			return;
+		}
+		auto column_idx = aggr.children[0]->Cast<BoundReferenceExpression>().index;
+		if (projection) {
+			auto &projected = *projection->select_list[column_idx];
+			if (projected.type != ExpressionType::BOUND_REF) {
+				return;
+			}
+			column_idx = projected.Cast<BoundReferenceExpression>().index;
+		}
+		if (!scan.projection_ids.empty()) {
+			column_idx = scan.projection_ids[column_idx];
+		}
+		auto column_id = scan.column_ids[column_idx];
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID || scan.returned_types[column_id] != type) {
+			return;
+		}
+		columns.push_back(column_idx);
+	}
+	auto statistics = make_shared_ptr<ScanAggregateStatistics>(std::move(columns));
+	bind_data.aggregate_statistics = statistics;
+	aggregate.scan_statistics = std::move(statistics);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
@@ -170,8 +239,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 			}
 		}
 		if (use_simple_aggregation) {
-			groupby = make_uniq_base<PhysicalOperator, PhysicalUngroupedAggregate>(op.types, std::move(op.expressions),
-			                                                                       op.estimated_cardinality);
+			auto ungrouped = make_uniq<PhysicalUngroupedAggregate>(op.types, std::move(op.expressions),
+			                                                       op.estimated_cardinality);
+			PushAggregatesIntoTableScan(*ungrouped, *plan);
+			groupby = std::move(ungrouped);
 		} else {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalHashAggregate>(
 			    context, op.types, std::move(op.expressions), op.estimated_cardinality);
@@ -2,12 +2,14 @@
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/optimizer/join_order/cost_model.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/common/operator/subtract.hpp"
@@ -129,6 +131,90 @@ static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { RewriteJoinCondition(child, offset); });
 }
 
+static bool GetIndexJoinType(JoinType join_type, bool index_on_left, JoinType &result) {
+	// the index join probes the index for every row of the probe side, the indexed table is never scanned
+	switch (join_type) {
+	case JoinType::INNER:
+		result = JoinType::INNER;
+		return true;
+	case JoinType::LEFT:
+	case JoinType::RIGHT:
+		result = JoinType::LEFT;
+		return index_on_left == (join_type == JoinType::RIGHT);
+	case JoinType::SEMI:
+	case JoinType::RIGHT_SEMI:
+		result = JoinType::SEMI;
+		return index_on_left == (join_type == JoinType::RIGHT_SEMI);
+	case JoinType::ANTI:
+	case JoinType::RIGHT_ANTI:
+		result = JoinType::ANTI;
+		return index_on_left == (join_type == JoinType::RIGHT_ANTI);
+	default:
+		return false;
+	}
+}
+
+static vector<idx_t> GetOutputColumns(const vector<idx_t> &projection_map, const PhysicalOperator &child) {
+	if (!projection_map.empty()) {
+		return projection_map;
+	}
+	vector<idx_t> result;
+	for (idx_t i = 0; i < child.types.size(); i++) {
+		result.push_back(i);
+	}
+	return result;
+}
+
+static unique_ptr<PhysicalOperator> TryPlanIndexJoin(ClientContext &context, LogicalComparisonJoin &op,
+                                                    unique_ptr<PhysicalOperator> &left,
+                                                    unique_ptr<PhysicalOperator> &right) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (!config.enable_optimizer) {
+		return nullptr;
+	}
+	// prefer an index on the right side, which keeps the order of the output columns
+	for (auto index_on_left : {false, true}) {
+		JoinType join_type;
+		if (!GetIndexJoinType(op.join_type, index_on_left, join_type)) {
+			continue;
+		}
+		auto &probe = index_on_left ? right : left;
+		auto &table_scan = index_on_left ? left : right;
+		if (!config.force_index_join &&
+		    !CostModel::IndexJoinIsCheaper(double(probe->estimated_cardinality),
+		                                   double(table_scan->estimated_cardinality))) {
+			continue;
+		}
+
+		// the conditions with the key columns of the table on their right side
+		vector<JoinCondition> conditions;
+		for (auto &cond : op.conditions) {
+			JoinCondition condition;
+			condition.left = index_on_left ? cond.right->Copy() : cond.left->Copy();
+			condition.right = index_on_left ? cond.left->Copy() : cond.right->Copy();
+			condition.comparison = cond.comparison;
+			conditions.push_back(std::move(condition));
+		}
+		auto index_name = PhysicalIndexJoin::FindJoinIndex(context, *table_scan, conditions);
+		if (index_name.empty()) {
+			continue;
+		}
+
+		auto &probe_projection_map = index_on_left ? op.right_projection_map : op.left_projection_map;
+		auto &table_projection_map = index_on_left ? op.left_projection_map : op.right_projection_map;
+		auto probe_output_columns = GetOutputColumns(probe_projection_map, *probe);
+		vector<idx_t> table_output_columns;
+		if (join_type == JoinType::INNER || join_type == JoinType::LEFT) {
+			table_output_columns = GetOutputColumns(table_projection_map, *table_scan);
+		}
+		auto &table = table_scan->Cast<PhysicalTableScan>().bind_data->Cast<TableScanBindData>().table;
+		return make_uniq<PhysicalIndexJoin>(op, std::move(probe), std::move(table_scan), std::move(conditions),
+		                                    join_type, std::move(probe_output_columns), table_output_columns, table,
+		                                    std::move(index_name), !index_on_left, op.estimated_cardinality);
+	}
+	return nullptr;
+}
+
 bool PhysicalPlanGenerator::HasEquality(vector<JoinCondition> &conds, idx_t &range_count) {
 	for (size_t c = 0; c < conds.size(); ++c) {
 		auto &cond = conds[c];
@@ -190,12 +276,20 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 
 	unique_ptr<PhysicalOperator> plan;
 	if (has_equality && !prefer_range_joins) {
+		// Equality join against a large table with a unique index on the join keys: probe the index
+		plan = TryPlanIndexJoin(context, op, left, right);
+		if (plan) {
+			return plan;
+		}
+
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
-		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
-		                                   op.join_type, op.left_projection_map, op.right_projection_map,
-		                                   std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		auto hash_join = make_uniq<PhysicalHashJoin>(
+		    op, std::move(left), std::move(right), std::move(op.conditions), op.join_type, op.left_projection_map,
+		    op.right_projection_map, std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		hash_join->filter_pushdown = std::move(op.filter_pushdown);
+		plan = std::move(hash_join);
 
 	} else {
 		static constexpr const idx_t NESTED_LOOP_JOIN_THRESHOLD = 5;
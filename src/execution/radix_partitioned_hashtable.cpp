@@ -141,6 +141,10 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! Minimum number of rows that a thread-local HT must have seen before it can decide to skip lookups
+	static constexpr const idx_t SKIP_LOOKUP_THRESHOLD = 262144;
+	//! If more than this fraction of the rows created a new group, the thread-local HT skips lookups
+	static constexpr const double UNIQUE_PERCENTAGE_THRESHOLD = 0.95;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -329,9 +333,12 @@ public:
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
+	//! Whether the HT skips lookups, because pre-aggregation did not reduce the data of this thread
+	bool skip_lookups;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : skip_lookups(false) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -456,9 +463,20 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	if (gstate.number_of_threads > 2) {
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
-		ht.ClearPointerTable();
+		if (!lstate.skip_lookups) {
+			ht.ClearPointerTable();
+		}
 		ht.ResetCount();
 		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
+
+		// If nearly every row created a new group, pre-aggregating in this thread does not reduce the data
+		// We stop doing lookups, and just materialize the rows, which are aggregated when the partitions are combined
+		if (!lstate.skip_lookups && ht.GetSinkCount() > RadixHTConfig::SKIP_LOOKUP_THRESHOLD &&
+		    static_cast<double>(ht.GetMaterializedCount()) / static_cast<double>(ht.GetSinkCount()) >
+		        RadixHTConfig::UNIQUE_PERCENTAGE_THRESHOLD) {
+			lstate.skip_lookups = true;
+			ht.SkipLookups(true);
+		}
 	}
 
 	// Check if we need to repartition
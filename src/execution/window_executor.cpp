@@ -897,6 +897,31 @@ bool WindowAggregateExecutor::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+bool WindowAggregateExecutor::IsRemovableAggregate() {
+	if (!wexpr.aggregate) {
+		return false;
+	}
+	// window exclusion punches holes into the frames
+	if (wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+
+	AggregateObject aggr(wexpr);
+	if (!aggr.function.window_remove || !aggr.function.simple_update || !aggr.function.combine) {
+		return false;
+	}
+
+	//	Frames with constant offsets move monotonically, so the rows enter and leave them one at a time
+	if (wexpr.start_expr && !wexpr.start_expr->IsScalar()) {
+		return false;
+	}
+	if (wexpr.end_expr && !wexpr.end_expr->IsScalar()) {
+		return false;
+	}
+
+	return (mode < WindowAggregationMode::COMBINE);
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result,
                               WindowExecutorState &lstate) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
@@ -928,6 +953,9 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
 		    make_uniq<WindowConstantAggregator>(aggr, wexpr.return_type, partition_mask, wexpr.exclude_clause, count);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
+	} else if (IsRemovableAggregate()) {
+		// slide a single state over the frames by removing the rows that leave them
+		aggregator = make_uniq<WindowRemovableAggregator>(aggr, wexpr.return_type, mode, wexpr.exclude_clause, count);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
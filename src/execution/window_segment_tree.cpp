@@ -1084,6 +1084,176 @@ void WindowSegmentTreePart::EvaluateLeaves(const WindowSegmentTree &tree, const
 	FlushStates(false);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowRemovableAggregator
+//===--------------------------------------------------------------------===//
+WindowRemovableAggregator::WindowRemovableAggregator(AggregateObject aggr, const LogicalType &result_type,
+                                                     WindowAggregationMode mode_p,
+                                                     const WindowExcludeMode exclude_mode_p, idx_t count)
+    : WindowSegmentTree(std::move(aggr), result_type, mode_p, exclude_mode_p, count) {
+	D_ASSERT(this->aggr.function.window_remove && this->aggr.function.simple_update);
+	D_ASSERT(exclude_mode == WindowExcludeMode::NO_OTHER);
+}
+
+WindowRemovableAggregator::~WindowRemovableAggregator() {
+}
+
+class WindowRemovableState : public WindowSegmentTreeState {
+public:
+	WindowRemovableState(const AggregateObject &aggr, const DataChunk &inputs, const ValidityMask &filter_mask);
+	~WindowRemovableState() override;
+
+	//! Destroys the running state
+	void Invalidate();
+	//! Looks up the frame in the segment tree and starts a new running state with it
+	void Reset(const WindowSegmentTree &tree, idx_t begin, idx_t end, Vector &result, idx_t row_idx);
+	//! Moves the running state to the frame, unless that needs more than max_rows updates
+	bool Slide(idx_t begin, idx_t end, idx_t max_rows);
+	//! Writes the result of the running state, which stays valid
+	void Finalize(Vector &result, idx_t rid);
+
+protected:
+	//! Adds the unfiltered rows in [begin, end) to the running state, or removes them from it
+	void Update(idx_t begin, idx_t end, bool remove);
+	//! Flush the buffered rows into the running state
+	void FlushRows(bool remove);
+
+	//! The running state, which is the first state of the segment tree part
+	data_ptr_t state_ptr;
+	//! A vector of pointers to the running state
+	Vector statef;
+	//! Whether the running state holds the frame [frame_begin, frame_end)
+	bool valid;
+	idx_t frame_begin;
+	idx_t frame_end;
+	//! Input data chunk, used for the rows entering and leaving the frame
+	DataChunk leaves;
+	//! The rows entering or leaving the frame
+	SelectionVector update_sel;
+	//! Count of buffered rows
+	idx_t flush_count;
+};
+
+WindowRemovableState::WindowRemovableState(const AggregateObject &aggr, const DataChunk &inputs,
+                                           const ValidityMask &filter_mask)
+    : WindowSegmentTreeState(aggr, inputs, filter_mask), state_ptr(FlatVector::GetData<data_ptr_t>(part.statef)[0]),
+      statef(Value::POINTER(CastPointerToValue(state_ptr))), valid(false), frame_begin(0), frame_end(0),
+      flush_count(0) {
+	statef.SetVectorType(VectorType::FLAT_VECTOR); // Prevent conversion of results to constants
+
+	if (inputs.ColumnCount() > 0) {
+		leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+	}
+	update_sel.Initialize();
+}
+
+WindowRemovableState::~WindowRemovableState() {
+	Invalidate();
+}
+
+unique_ptr<WindowAggregatorState> WindowRemovableAggregator::GetLocalState() const {
+	return make_uniq<WindowRemovableState>(aggr, inputs, filter_mask);
+}
+
+void WindowRemovableState::Invalidate() {
+	if (valid && aggr.function.destructor) {
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+		aggr.function.destructor(statef, aggr_input_data, 1);
+	}
+	valid = false;
+}
+
+void WindowRemovableState::Reset(const WindowSegmentTree &tree, idx_t begin, idx_t end, Vector &result,
+                                 idx_t row_idx) {
+	Invalidate();
+	part.Evaluate(tree, &begin, &end, result, 1, row_idx, WindowSegmentTreePart::FULL);
+	valid = true;
+	frame_begin = begin;
+	frame_end = end;
+}
+
+bool WindowRemovableState::Slide(idx_t begin, idx_t end, idx_t max_rows) {
+	//	Frames that do not overlap the running state are looked up in the tree
+	if (!valid || begin >= frame_end || end <= frame_begin) {
+		return false;
+	}
+	const auto begin_rows = begin < frame_begin ? frame_begin - begin : begin - frame_begin;
+	const auto end_rows = end < frame_end ? frame_end - end : end - frame_end;
+	if (begin_rows + end_rows > max_rows) {
+		return false;
+	}
+
+	//	Remove the rows that left the frame before adding the ones that entered it,
+	//	so the running state only ever holds the rows of one of the two frames
+	Update(frame_begin, begin, true);
+	Update(end, frame_end, true);
+	Update(begin, frame_begin, false);
+	Update(frame_end, end, false);
+
+	frame_begin = begin;
+	frame_end = end;
+	return true;
+}
+
+void WindowRemovableState::Update(idx_t begin, idx_t end, bool remove) {
+	for (auto i = begin; i < end; ++i) {
+		if (filter_mask.RowIsValid(i)) {
+			update_sel.set_index(flush_count++, i);
+			if (flush_count >= STANDARD_VECTOR_SIZE) {
+				FlushRows(remove);
+			}
+		}
+	}
+	FlushRows(remove);
+}
+
+void WindowRemovableState::FlushRows(bool remove) {
+	if (!flush_count) {
+		return;
+	}
+
+	leaves.Slice(inputs, update_sel, flush_count);
+
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	auto update = remove ? aggr.function.window_remove : aggr.function.simple_update;
+	update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), state_ptr, flush_count);
+
+	flush_count = 0;
+}
+
+void WindowRemovableState::Finalize(Vector &result, idx_t rid) {
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.finalize(statef, aggr_input_data, result, 1, rid);
+}
+
+void WindowRemovableAggregator::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result,
+                                         idx_t count, idx_t row_idx) const {
+	D_ASSERT(count > 0);
+	auto &lrstate = lstate.Cast<WindowRemovableState>();
+	auto window_begin = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto window_end = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+
+	//	Small frames are cheaper to evaluate in bulk with the segment tree
+	const auto last = count - 1;
+	if (window_end[0] < window_begin[0] + MIN_SLIDING_FRAME &&
+	    window_end[last] < window_begin[last] + MIN_SLIDING_FRAME) {
+		lrstate.Invalidate();
+		WindowSegmentTree::Evaluate(lstate, bounds, result, count, row_idx);
+		return;
+	}
+
+	//	Sliding is worth it as long as it updates fewer rows than a lookup in the tree touches
+	const auto max_rows = TREE_FANOUT * levels_flat_start.size();
+	for (idx_t rid = 0; rid < count; ++rid) {
+		const auto begin = window_begin[rid];
+		const auto end = MaxValue(begin, window_end[rid]);
+		if (!lrstate.Slide(begin, end, max_rows)) {
+			lrstate.Reset(*this, begin, end, result, row_idx + rid);
+		}
+		lrstate.Finalize(result, rid);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // WindowDistinctAggregator
 //===--------------------------------------------------------------------===//
@@ -208,6 +208,13 @@ struct CountFunction : public BaseCountFunction {
 		}
 		}
 	}
+
+	static void CountRemove(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count, data_ptr_t state_p,
+	                        idx_t count) {
+		STATE removed = 0;
+		CountUpdate(inputs, aggr_input_data, input_count, data_ptr_cast(&removed), count);
+		*reinterpret_cast<STATE *>(state_p) -= removed;
+	}
 };
 
 AggregateFunction CountFun::GetFunction() {
@@ -218,6 +225,7 @@ AggregateFunction CountFun::GetFunction() {
 	                      FunctionNullHandling::SPECIAL_HANDLING, CountFunction::CountUpdate);
 	fun.name = "count";
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+	fun.window_remove = CountFunction::CountRemove;
 	return fun;
 }
 
@@ -180,6 +180,10 @@ string PragmaDatabaseSize(ClientContext &context, const FunctionParameters &para
 	return "SELECT * FROM pragma_database_size();";
 }
 
+string PragmaWALReplayInfo(ClientContext &context, const FunctionParameters &parameters) {
+	return "SELECT * FROM pragma_wal_replay_info();";
+}
+
 string PragmaStorageInfo(ClientContext &context, const FunctionParameters &parameters) {
 	return StringUtil::Format("SELECT * FROM pragma_storage_info('%s');", parameters.values[0].ToString());
 }
@@ -205,6 +209,7 @@ void PragmaQueries::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaStatement("version", PragmaVersion));
 	set.AddFunction(PragmaFunction::PragmaStatement("platform", PragmaPlatform));
 	set.AddFunction(PragmaFunction::PragmaStatement("database_size", PragmaDatabaseSize));
+	set.AddFunction(PragmaFunction::PragmaStatement("wal_replay_info", PragmaWALReplayInfo));
 	set.AddFunction(PragmaFunction::PragmaStatement("functions", PragmaFunctionsQuery));
 	set.AddFunction(PragmaFunction::PragmaCall("import_database", PragmaImportDatabase, {LogicalType::VARCHAR}));
 	set.AddFunction(
@@ -19,6 +19,12 @@ static unique_ptr<FunctionData> DuckDBTemporaryFilesBind(ClientContext &context,
 	names.emplace_back("size");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("spilled_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("compression_ratio");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
 	return nullptr;
 }
 
@@ -46,6 +52,14 @@ void DuckDBTemporaryFilesFunction(ClientContext &context, TableFunctionInput &da
 		output.SetValue(col++, count, entry.path);
 		// database_oid, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
+		// spilled_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.spilled_size)));
+		// compression_ratio, DOUBLE
+		if (entry.size == 0) {
+			output.SetValue(col++, count, Value());
+		} else {
+			output.SetValue(col++, count, Value::DOUBLE(double(entry.spilled_size) / double(entry.size)));
+		}
 		count++;
 	}
 	output.SetCardinality(count);
@@ -0,0 +1,68 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+
+namespace duckdb {
+
+struct PragmaWALReplayInfoData : public GlobalTableFunctionState {
+	PragmaWALReplayInfoData() : index(0) {
+	}
+
+	idx_t index;
+	vector<reference<AttachedDatabase>> databases;
+};
+
+static unique_ptr<FunctionData> PragmaWALReplayInfoBind(ClientContext &context, TableFunctionBindInput &input,
+                                                        vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("wal_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("replayed_transactions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("replay_time");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("checkpoint_time");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> PragmaWALReplayInfoInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<PragmaWALReplayInfoData>();
+	result->databases = DatabaseManager::Get(context).GetDatabases(context);
+	return std::move(result);
+}
+
+void PragmaWALReplayInfoFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<PragmaWALReplayInfoData>();
+	idx_t row = 0;
+	for (; data.index < data.databases.size() && row < STANDARD_VECTOR_SIZE; data.index++) {
+		auto &db = data.databases[data.index].get();
+		if (db.IsSystem() || db.IsTemporary() || !db.GetCatalog().IsDuckCatalog()) {
+			continue;
+		}
+		auto &info = db.GetStorageManager().GetWALReplayInfo();
+		idx_t col = 0;
+		output.data[col++].SetValue(row, Value(db.GetName()));
+		output.data[col++].SetValue(row, Value::BIGINT(NumericCast<int64_t>(info.wal_size)));
+		output.data[col++].SetValue(row, Value::BIGINT(NumericCast<int64_t>(info.transaction_count)));
+		output.data[col++].SetValue(row, Value::DOUBLE(info.replay_time));
+		output.data[col++].SetValue(row, Value::DOUBLE(info.checkpoint_time));
+		row++;
+	}
+	output.SetCardinality(row);
+}
+
+void PragmaWALReplayInfo::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("pragma_wal_replay_info", {}, PragmaWALReplayInfoFunction, PragmaWALReplayInfoBind,
+	                              PragmaWALReplayInfoInit));
+}
+
+} // namespace duckdb
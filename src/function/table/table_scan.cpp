@@ -74,6 +74,7 @@ static unique_ptr<LocalTableFunctionState> TableScanInitLocal(ExecutionContext &
 		col = storage_idx;
 	}
 	result->scan_state.Initialize(std::move(column_ids), input.filters.get());
+	result->scan_state.options.aggregate_statistics = bind_data.aggregate_statistics.get();
 	TableScanParallelStateNext(context.client, input.bind_data.get(), result.get(), gstate);
 	if (input.CanRemoveFilterColumns()) {
 		auto &tsgs = gstate->Cast<TableScanGlobalState>();
@@ -90,6 +91,9 @@ unique_ptr<GlobalTableFunctionState> TableScanInitGlobal(ClientContext &context,
 	D_ASSERT(input.bind_data);
 	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
 	auto result = make_uniq<TableScanGlobalState>(context, input.bind_data.get());
+	if (bind_data.aggregate_statistics) {
+		bind_data.aggregate_statistics->Initialize(DuckTransaction::Get(context, bind_data.table.catalog));
+	}
 	bind_data.table.GetStorage().InitializeParallelScan(context, result->state);
 	if (input.CanRemoveFilterColumns()) {
 		result->projection_ids = input.projection_ids;
@@ -211,25 +215,42 @@ unique_ptr<NodeStatistics> TableScanCardinality(ClientContext &context, const Fu
 // Index Scan
 //===--------------------------------------------------------------------===//
 struct IndexScanGlobalState : public GlobalTableFunctionState {
-	explicit IndexScanGlobalState(data_ptr_t row_id_data) : row_ids(LogicalType::ROW_TYPE, row_id_data) {
-	}
+	//! The index that is scanned
+	optional_ptr<ART> index;
+	//! The remaining range of the index that is scanned
+	ARTIndexScanState index_state;
+	//! The row ids of the last keys fetched from the index, and how many of them were fetched from the table
+	vector<row_t> row_ids;
+	idx_t row_id_offset = 0;
 
-	Vector row_ids;
 	ColumnFetchState fetch_state;
 	TableScanState local_storage_state;
 	vector<storage_t> column_ids;
-	bool finished;
+
+	//! The projection ids and the DataChunk containing all read columns, in case filter columns are pruned
+	vector<idx_t> projection_ids;
+	DataChunk all_columns;
 };
 
 static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
 	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
-	data_ptr_t row_id_data = nullptr;
-	if (!bind_data.result_ids.empty()) {
-		row_id_data = (data_ptr_t)&bind_data.result_ids[0]; // NOLINT - this is not pretty
-	}
-	auto result = make_uniq<IndexScanGlobalState>(row_id_data);
+	auto result = make_uniq<IndexScanGlobalState>();
+	auto &storage = bind_data.table.GetStorage();
 	auto &local_storage = LocalStorage::Get(context, bind_data.table.catalog);
 
+	auto &info = storage.GetDataTableInfo();
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
+		if (art_index.GetIndexName() != bind_data.index_name) {
+			return false;
+		}
+		result->index = &art_index;
+		return true;
+	});
+	if (!result->index) {
+		throw InternalException("Index \"%s\" of the index scan not found", bind_data.index_name);
+	}
+	result->index_state = bind_data.index_state->Cast<ARTIndexScanState>();
+
 	result->local_storage_state.options.force_fetch_row = ClientConfig::GetConfig(context).force_fetch_row;
 
 	result->column_ids.reserve(input.column_ids.size());
@@ -237,26 +258,62 @@ static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &c
 		result->column_ids.push_back(GetStorageIndex(bind_data.table, id));
 	}
 	result->local_storage_state.Initialize(result->column_ids, input.filters.get());
-	local_storage.InitializeScan(bind_data.table.GetStorage(), result->local_storage_state.local_state, input.filters);
+	local_storage.InitializeScan(storage, result->local_storage_state.local_state, input.filters);
 
-	result->finished = false;
+	if (input.CanRemoveFilterColumns()) {
+		result->projection_ids = input.projection_ids;
+		vector<LogicalType> scanned_types;
+		const auto &columns = bind_data.table.GetColumns();
+		for (const auto &col_idx : input.column_ids) {
+			if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+				scanned_types.emplace_back(LogicalType::ROW_TYPE);
+			} else {
+				scanned_types.push_back(columns.GetColumn(LogicalIndex(col_idx)).Type());
+			}
+		}
+		result->all_columns.Initialize(context, scanned_types);
+	}
 	return std::move(result);
 }
 
-static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
-	auto &state = data_p.global_state->Cast<IndexScanGlobalState>();
+static void IndexScanFetch(ClientContext &context, const TableScanBindData &bind_data, IndexScanGlobalState &state,
+                           DataChunk &output) {
 	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
 	auto &local_storage = LocalStorage::Get(transaction);
 
-	if (!state.finished) {
-		bind_data.table.GetStorage().Fetch(transaction, output, state.column_ids, state.row_ids,
-		                                   bind_data.result_ids.size(), state.fetch_state);
-		state.finished = true;
+	// stream the row ids from the index, and fetch their rows a vector at a time
+	while (state.row_id_offset < state.row_ids.size() || !state.index_state.finished) {
+		if (state.row_id_offset == state.row_ids.size()) {
+			state.row_ids.clear();
+			state.row_id_offset = 0;
+			state.index->Scan(state.index_state, STANDARD_VECTOR_SIZE, state.row_ids);
+			continue;
+		}
+		auto fetch_count = MinValue<idx_t>(state.row_ids.size() - state.row_id_offset, STANDARD_VECTOR_SIZE);
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(state.row_ids.data() + state.row_id_offset));
+		state.row_id_offset += fetch_count;
+		bind_data.table.GetStorage().Fetch(transaction, output, state.column_ids, row_ids, fetch_count,
+		                                   state.fetch_state);
+		if (output.size() > 0) {
+			// rows that are not visible to this transaction are skipped
+			return;
+		}
 	}
-	if (output.size() == 0) {
-		local_storage.Scan(state.local_storage_state.local_state, state.column_ids, output);
+	// the rows that were appended by this transaction are not part of the index yet
+	local_storage.Scan(state.local_storage_state.local_state, state.column_ids, output);
+}
+
+static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
+	auto &state = data_p.global_state->Cast<IndexScanGlobalState>();
+
+	if (state.projection_ids.empty()) {
+		IndexScanFetch(context, bind_data, state, output);
+		return;
 	}
+	state.all_columns.Reset();
+	IndexScanFetch(context, bind_data, state, state.all_columns);
+	output.ReferenceColumns(state.all_columns, state.projection_ids);
 }
 
 static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &expr, bool &rewrite_possible) {
@@ -298,11 +355,6 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 		// if there were filters before we can't convert this to an index scan
 		return;
 	}
-	if (!get.projection_ids.empty()) {
-		// if columns were pruned by RemoveUnusedColumns we can't convert this to an index scan,
-		// because index scan does not support filter_prune (yet)
-		return;
-	}
 	if (filters.empty()) {
 		// no indexes or no filters: skip the pushdown
 		return;
@@ -312,40 +364,64 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 	auto &info = storage.GetDataTableInfo();
 	auto &transaction = Transaction::Get(context, bind_data.table.catalog);
 
+	// an index scan is only faster than a sequential scan if it selects few rows
+	auto total_rows = double(storage.GetTotalRows());
+	auto max_count = MaxValue<idx_t>(config.index_scan_max_count, idx_t(config.index_scan_percentage * total_rows));
+
 	// bind and scan any ART indexes
 	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
-		// first rewrite the index expression so the ColumnBindings align with the column bindings of the current table
-		if (art_index.unbound_expressions.size() > 1) {
-			// NOTE: index scans are not (yet) supported for compound index keys
+		// first rewrite the index expressions so the ColumnBindings align with the column bindings of the current
+		// table, only the leading key columns that are scanned can be used by the index scan
+		vector<unique_ptr<Expression>> index_expressions;
+		for (auto &unbound_expression : art_index.unbound_expressions) {
+			auto index_expression = unbound_expression->Copy();
+			bool rewrite_possible = true;
+			RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
+			if (!rewrite_possible) {
+				break;
+			}
+			index_expressions.push_back(std::move(index_expression));
+		}
+		if (index_expressions.empty()) {
 			return false;
 		}
 
-		auto index_expression = art_index.unbound_expressions[0]->Copy();
-		bool rewrite_possible = true;
-		RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
-		if (!rewrite_possible) {
-			// could not rewrite!
+		// try to find a range of the index that matches the filter expressions
+		auto index_state = art_index.TryInitializeScan(transaction, index_expressions, filters);
+		if (!index_state) {
 			return false;
 		}
-
-		// try to find a matching index for any of the filter expressions
-		for (auto &filter : filters) {
-			auto index_state = art_index.TryInitializeScan(transaction, *index_expression, *filter);
-			if (index_state != nullptr) {
-				if (art_index.Scan(transaction, storage, *index_state, STANDARD_VECTOR_SIZE, bind_data.result_ids)) {
-					// use an index scan!
-					bind_data.is_index_scan = true;
-					get.function = TableScanFunction::GetIndexScanFunction();
-				} else {
-					bind_data.result_ids.clear();
-				}
-				return true;
-			}
+		// count the matching row ids, without fetching more than needed to decide
+		auto count_state = index_state->Cast<ARTIndexScanState>();
+		vector<row_t> row_ids;
+		art_index.Scan(count_state, max_count + 1, row_ids);
+		if (row_ids.size() > max_count) {
+			return false;
 		}
-		return false;
+
+		// use an index scan!
+		bind_data.is_index_scan = true;
+		bind_data.index_name = art_index.GetIndexName();
+		bind_data.index_state = std::move(index_state);
+		get.function = TableScanFunction::GetIndexScanFunction();
+		return true;
 	});
 }
 
+bool TableScanBindData::Equals(const FunctionData &other_p) const {
+	auto &other = other_p.Cast<TableScanBindData>();
+	if (&other.table != &table || is_index_scan != other.is_index_scan) {
+		return false;
+	}
+	if (!is_index_scan) {
+		return true;
+	}
+	auto &index_range = index_state->Cast<ARTIndexScanState>();
+	auto &other_range = other.index_state->Cast<ARTIndexScanState>();
+	return index_name == other.index_name && index_range.lower_bound == other_range.lower_bound &&
+	       index_range.upper_bound == other_range.upper_bound && index_range.finished == other_range.finished;
+}
+
 string TableScanToString(const FunctionData *bind_data_p) {
 	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
 	string result = bind_data.table.name;
@@ -360,7 +436,14 @@ static void TableScanSerialize(Serializer &serializer, const optional_ptr<Functi
 	serializer.WriteProperty(102, "table", bind_data.table.name);
 	serializer.WriteProperty(103, "is_index_scan", bind_data.is_index_scan);
 	serializer.WriteProperty(104, "is_create_index", bind_data.is_create_index);
-	serializer.WriteProperty(105, "result_ids", bind_data.result_ids);
+	// 105 (result_ids) was removed when index scans started streaming their row ids during execution
+	if (bind_data.is_index_scan) {
+		auto &index_state = bind_data.index_state->Cast<ARTIndexScanState>();
+		serializer.WriteProperty(106, "index_name", bind_data.index_name);
+		serializer.WriteProperty(107, "index_lower_bound", index_state.lower_bound);
+		serializer.WriteProperty(108, "index_upper_bound", index_state.upper_bound);
+		serializer.WriteProperty(109, "index_range_empty", index_state.finished);
+	}
 }
 
 static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer, TableFunction &function) {
@@ -375,7 +458,15 @@ static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer,
 	auto result = make_uniq<TableScanBindData>(catalog_entry.Cast<DuckTableEntry>());
 	deserializer.ReadProperty(103, "is_index_scan", result->is_index_scan);
 	deserializer.ReadProperty(104, "is_create_index", result->is_create_index);
-	deserializer.ReadProperty(105, "result_ids", result->result_ids);
+	deserializer.ReadDeletedProperty<vector<row_t>>(105, "result_ids");
+	if (result->is_index_scan) {
+		auto index_state = make_uniq<ARTIndexScanState>();
+		deserializer.ReadProperty(106, "index_name", result->index_name);
+		deserializer.ReadProperty(107, "index_lower_bound", index_state->lower_bound);
+		deserializer.ReadProperty(108, "index_upper_bound", index_state->upper_bound);
+		deserializer.ReadProperty(109, "index_range_empty", index_state->finished);
+		result->index_state = std::move(index_state);
+	}
 	return std::move(result);
 }
 
@@ -392,6 +483,7 @@ TableFunction TableScanFunction::GetIndexScanFunction() {
 	scan_function.get_batch_index = nullptr;
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = false;
+	scan_function.filter_prune = true;
 	scan_function.get_bind_info = TableScanGetBindInfo;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
@@ -413,6 +505,7 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = true;
 	scan_function.filter_prune = true;
+	scan_function.global_initialization = TableFunctionInitialization::INITIALIZE_ON_EXECUTE;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
 	return scan_function;
@@ -300,6 +300,8 @@ enum class TableColumnType : uint8_t;
 
 enum class TableFilterType : uint8_t;
 
+enum class TableFunctionInitialization : uint8_t;
+
 enum class TableReferenceType : uint8_t;
 
 enum class TableScanType : uint8_t;
@@ -308,6 +310,8 @@ enum class TaskExecutionMode : uint8_t;
 
 enum class TaskExecutionResult : uint8_t;
 
+enum class ThreadPinningMode : uint8_t;
+
 enum class TimestampCastResult : uint8_t;
 
 enum class TransactionType : uint8_t;
@@ -739,6 +743,9 @@ const char* EnumUtil::ToChars<TableColumnType>(TableColumnType value);
 template<>
 const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value);
 
+template<>
+const char* EnumUtil::ToChars<TableFunctionInitialization>(TableFunctionInitialization value);
+
 template<>
 const char* EnumUtil::ToChars<TableReferenceType>(TableReferenceType value);
 
@@ -751,6 +758,9 @@ const char* EnumUtil::ToChars<TaskExecutionMode>(TaskExecutionMode value);
 template<>
 const char* EnumUtil::ToChars<TaskExecutionResult>(TaskExecutionResult value);
 
+template<>
+const char* EnumUtil::ToChars<ThreadPinningMode>(ThreadPinningMode value);
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value);
 
@@ -1196,6 +1206,9 @@ TableColumnType EnumUtil::FromString<TableColumnType>(const char *value);
 template<>
 TableFilterType EnumUtil::FromString<TableFilterType>(const char *value);
 
+template<>
+TableFunctionInitialization EnumUtil::FromString<TableFunctionInitialization>(const char *value);
+
 template<>
 TableReferenceType EnumUtil::FromString<TableReferenceType>(const char *value);
 
@@ -1208,6 +1221,9 @@ TaskExecutionMode EnumUtil::FromString<TaskExecutionMode>(const char *value);
 template<>
 TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value);
 
+template<>
+ThreadPinningMode EnumUtil::FromString<ThreadPinningMode>(const char *value);
+
 template<>
 TimestampCastResult EnumUtil::FromString<TimestampCastResult>(const char *value);
 
@@ -0,0 +1,25 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/thread_pinning_mode.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! How the background threads of the task scheduler are pinned to CPUs
+enum class ThreadPinningMode : uint8_t {
+	//! Threads are not pinned
+	NONE = 0,
+	//! Every thread is pinned to a single CPU
+	CORES = 1,
+	//! Threads are spread over the NUMA nodes, and pinned to all CPUs of their node
+	NUMA = 2
+};
+
+} // namespace duckdb
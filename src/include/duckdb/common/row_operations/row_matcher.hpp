@@ -36,6 +36,9 @@ public:
 
 	//! Initializes the RowMatcher, filling match_functions using layout and predicates
 	void Initialize(const bool no_match_sel, const TupleDataLayout &layout, const Predicates &predicates);
+	//! Initializes the RowMatcher to match only the given columns, in the given order, with the given predicates
+	void Initialize(const bool no_match_sel, const TupleDataLayout &layout, const Predicates &predicates,
+	                const vector<column_t> &columns);
 	//! Given a DataChunk on the LHS, on which we've called TupleDataCollection::ToUnifiedFormat,
 	//! we match it with rows on the RHS, according to the given layout and locations.
 	//! Initially, 'sel' has 'count' entries which point to what needs to be compared.
@@ -58,6 +61,8 @@ private:
 
 private:
 	vector<MatchFunction> match_functions;
+	//! The column of each match function
+	vector<column_t> columns;
 };
 
 } // namespace duckdb
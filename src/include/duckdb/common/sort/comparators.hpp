@@ -26,8 +26,9 @@ public:
 	//! (only in case we cannot simply 'memcmp' - if there are blob columns)
 	static int CompareTuple(const SBScanState &left, const SBScanState &right, const data_ptr_t &l_ptr,
 	                        const data_ptr_t &r_ptr, const SortLayout &sort_layout, const bool &external_sort);
-	//! Compare two blob values
-	static int CompareVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type);
+	//! Compare two blob values, whose first prefix_len bytes are known to be equal (if they are strings)
+	static int CompareVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type,
+	                      const idx_t &prefix_len);
 
 private:
 	//! Compares two blob values that were initially tied by their prefix
@@ -36,6 +37,8 @@ private:
 	//! Compare two fixed-size values
 	template <class T>
 	static int TemplatedCompareVal(const data_ptr_t &left_ptr, const data_ptr_t &right_ptr);
+	//! Compare two strings with a single pass over the bytes that follow the (equal) prefix
+	static int CompareStringVal(const data_ptr_t &left_ptr, const data_ptr_t &right_ptr, const idx_t &prefix_len);
 
 	//! Compare two values at the pointers (can be recursive if nested type)
 	static int CompareValAndAdvance(data_ptr_t &l_ptr, data_ptr_t &r_ptr, const LogicalType &type, bool valid);
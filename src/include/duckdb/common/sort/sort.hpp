@@ -22,6 +22,8 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Strings up to this length are stored in the sorting key entirely, so that ties never have to be broken
+	static constexpr idx_t MAX_NORMALIZED_STRING_LENGTH = 64;
 };
 
 struct SortLayout {
@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+class Serializer;
+class Deserializer;
+
+//! The BloomFilter class holds a register-blocked bloom filter over 64-bit hashes
+//! Every hash maps to a single 64-bit word in which BLOOM_FILTER_PROBES bits are set, so inserting or probing a key
+//! touches exactly one word (and one cache line)
+class BloomFilter {
+public:
+	BloomFilter();
+	//! Creates an empty bloom filter sized for the given amount of keys
+	explicit BloomFilter(idx_t expected_count);
+
+	//! The amount of bits that are reserved for every key
+	static constexpr const idx_t BITS_PER_KEY = 16;
+	//! The amount of bits that are set in the word for every key
+	static constexpr const idx_t BLOOM_FILTER_PROBES = 4;
+
+public:
+	//! Insert a single hash into the bloom filter
+	inline void Insert(hash_t hash) {
+		words[GetWordIndex(hash)] |= GetWordMask(hash);
+	}
+	//! Whether or not the hash can be in the bloom filter (false positives are possible, false negatives are not)
+	inline bool Lookup(hash_t hash) const {
+		auto mask = GetWordMask(hash);
+		return (words[GetWordIndex(hash)] & mask) == mask;
+	}
+
+	//! Insert the hashes of all non-NULL values of the given vector
+	void Insert(Vector &values, idx_t count);
+
+	//! Merge another bloom filter of the same size into this bloom filter
+	void Merge(const BloomFilter &other);
+	//! Whether or not this bloom filter is equal to another one
+	bool Equals(const BloomFilter &other) const;
+
+	//! The size of the bloom filter in bytes
+	idx_t SizeInBytes() const {
+		return words.size() * sizeof(uint64_t);
+	}
+	const vector<uint64_t> &GetWords() const {
+		return words;
+	}
+
+	void Serialize(Serializer &serializer) const;
+	static BloomFilter Deserialize(Deserializer &deserializer);
+
+private:
+	inline idx_t GetWordIndex(hash_t hash) const {
+		return hash & word_mask;
+	}
+	static inline uint64_t GetWordMask(hash_t hash) {
+		// the lower bits of the hash select the word, the upper 24 bits select the bits within the word
+		return (1ULL << ((hash >> 40) & 63)) | (1ULL << ((hash >> 46) & 63)) | (1ULL << ((hash >> 52) & 63)) |
+		       (1ULL << ((hash >> 58) & 63));
+	}
+	void Initialize(idx_t word_count);
+
+private:
+	//! The words of the bloom filter (the amount of words is always a power of two)
+	vector<uint64_t> words;
+	//! Mask to obtain the word index from a hash
+	idx_t word_mask;
+};
+
+} // namespace duckdb
@@ -318,6 +318,15 @@ struct DictionaryVector {
 		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
 		return vector.auxiliary->Cast<VectorChildBuffer>().data;
 	}
+	//! The amount of entries in the dictionary of the vector (if known)
+	static inline optional_idx DictionarySize(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.buffer->Cast<DictionaryBuffer>().GetDictionarySize();
+	}
+	static inline void SetDictionarySize(Vector &vector, idx_t dictionary_size) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		vector.buffer->Cast<DictionaryBuffer>().SetDictionarySize(dictionary_size);
+	}
 };
 
 struct FlatVector {
@@ -23,31 +23,32 @@ static inline void KahanAddInternal(double input, double &summed, double &err) {
 
 template <class T>
 struct SumState {
-	bool isset;
+	//! The number of summed values, the sum is NULL if there are none
+	uint64_t count;
 	T value;
 
 	void Initialize() {
-		this->isset = false;
+		this->count = 0;
 	}
 
 	void Combine(const SumState<T> &other) {
-		this->isset = other.isset || this->isset;
+		this->count += other.count;
 		this->value += other.value;
 	}
 };
 
 struct KahanSumState {
-	bool isset;
+	uint64_t count;
 	double value;
 	double err;
 
 	void Initialize() {
-		this->isset = false;
+		this->count = 0;
 		this->err = 0.0;
 	}
 
 	void Combine(const KahanSumState &other) {
-		this->isset = other.isset || this->isset;
+		this->count += other.count;
 		KahanAddInternal(other.value, this->value, this->err);
 		KahanAddInternal(other.err, this->value, this->err);
 	}
@@ -63,6 +64,16 @@ struct RegularAdd {
 	static void AddConstant(STATE &state, T input, idx_t count) {
 		state.value += input * int64_t(count);
 	}
+
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value -= input;
+	}
+
+	template <class STATE, class T>
+	static void SubtractConstant(STATE &state, T input, idx_t count) {
+		state.value -= input * int64_t(count);
+	}
 };
 
 struct HugeintAdd {
@@ -75,6 +86,16 @@ struct HugeintAdd {
 	static void AddConstant(STATE &state, T input, idx_t count) {
 		AddNumber(state, Hugeint::Multiply(input, UnsafeNumericCast<int64_t>(count)));
 	}
+
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value = Hugeint::Subtract(state.value, input);
+	}
+
+	template <class STATE, class T>
+	static void SubtractConstant(STATE &state, T input, idx_t count) {
+		SubtractNumber(state, Hugeint::Multiply(input, UnsafeNumericCast<int64_t>(count)));
+	}
 };
 
 struct KahanAdd {
@@ -140,10 +161,42 @@ struct AddToHugeint {
 			}
 		}
 	}
+
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value -= hugeint_t(input);
+	}
+
+	template <class STATE, class T>
+	static void SubtractConstant(STATE &state, T input, idx_t count) {
+		state.value -= hugeint_t(input) * Hugeint::Convert(count);
+	}
+};
+
+//! Removes values from a sum again, which is exact for the integer additions
+template <class STATEOP, class ADDOP>
+struct BaseSumRemoveOperation {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		STATEOP::template RemoveValues<STATE>(state, 1);
+		ADDOP::template SubtractNumber<STATE, INPUT_TYPE>(state, input);
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &, idx_t count) {
+		STATEOP::template RemoveValues<STATE>(state, count);
+		ADDOP::template SubtractConstant<STATE, INPUT_TYPE>(state, input, count);
+	}
+
+	static bool IgnoreNull() {
+		return true;
+	}
 };
 
 template <class STATEOP, class ADDOP>
 struct BaseSumOperation {
+	using RemoveOperation = BaseSumRemoveOperation<STATEOP, ADDOP>;
+
 	template <class STATE>
 	static void Initialize(STATE &state) {
 		state.value = 0;
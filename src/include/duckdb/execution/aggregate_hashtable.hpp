@@ -90,6 +90,8 @@ public:
 public:
 	//! The hash table load factor, when a resize is triggered
 	constexpr static double LOAD_FACTOR = 1.5;
+	//! The maximum size of a dictionary whose groups are cached when adding dictionary vectors
+	constexpr static idx_t MAX_DICTIONARY_SIZE = 20000;
 
 	//! Get the layout of this HT
 	const TupleDataLayout &GetLayout() const;
@@ -135,6 +137,13 @@ public:
 	void SetRadixBits(idx_t radix_bits);
 	//! Initializes the PartitionedTupleData
 	void InitializePartitionedData();
+	//! Whether to skip the lookups in the pointer table. Every added row then becomes a new group, and duplicate
+	//! groups are only aggregated when the partitioned data is combined
+	void SkipLookups(bool skip_lookups);
+	//! Number of rows added to the HT since it was created (not reset by ResetCount)
+	idx_t GetSinkCount() const;
+	//! Number of groups created in the HT since it was created (not reset by ResetCount)
+	idx_t GetMaterializedCount() const;
 
 	//! Executes the filter(if any) and update the aggregates
 	void Combine(GroupedAggregateHashTable &other);
@@ -162,6 +171,16 @@ private:
 		Vector addresses;
 		unsafe_unique_array<UnifiedVectorFormat> group_data;
 		DataChunk group_chunk;
+
+		//! The buffer of the dictionary whose groups are cached, see TryAddDictionaryGroups
+		buffer_ptr<VectorBuffer> dictionary;
+		//! The address of the group of each entry of the dictionary, or nullptr if it was not looked up yet
+		unsafe_unique_array<data_ptr_t> dictionary_addresses;
+		idx_t dictionary_capacity;
+		//! The entries of the dictionary that are looked up, and their groups
+		SelectionVector dictionary_entries;
+		DataChunk dictionary_groups;
+		Vector dictionary_group_addresses;
 	} state;
 
 	//! The number of radix bits to partition by
@@ -174,6 +193,11 @@ private:
 
 	//! The number of groups in the HT
 	idx_t count;
+	//! The number of rows added to the HT, and the number of groups created for them
+	idx_t sink_count;
+	idx_t materialized_count;
+	//! Whether lookups in the pointer table are skipped
+	bool skip_lookups;
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
 	idx_t capacity;
 	//! The hash map (pointer table) of the HT: allocated data and pointer into it
@@ -201,6 +225,19 @@ private:
 	//! Does the actual group matching / creation
 	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes, Vector &addresses,
 	                                 SelectionVector &new_groups);
+	//! Appends every row as a new group, without looking it up in the pointer table
+	idx_t CreateGroupsWithoutLookups(DataChunk &groups, Vector &group_hashes, Vector &addresses,
+	                                 SelectionVector &new_groups);
+	//! Makes the group chunk reference the groups and their hashes, and converts it to unified format
+	void InitializeGroupChunk(DataChunk &groups, Vector &group_hashes);
+	//! If the only group column is a dictionary vector from the storage, the groups are looked up once per entry of
+	//! the dictionary, rather than once per row. Returns false if the groups cannot be added this way
+	bool TryAddDictionaryGroups(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter,
+	                            idx_t &new_group_count);
+	//! Forgets the cached groups of the dictionary, because their addresses are no longer valid
+	void ResetDictionaryState();
+	//! Updates the aggregates of the rows whose (aggregate) addresses are in state.addresses
+	void UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter);
 
 	//! Verify the pointer table of the HT
 	void Verify();
@@ -11,6 +11,7 @@
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/execution/index/art/node.hpp"
 #include "duckdb/common/array.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
 
 namespace duckdb {
 
@@ -25,12 +26,21 @@ class ARTKey;
 class FixedSizeAllocator;
 
 // structs
-struct ARTIndexScanState;
 struct ARTFlags {
 	vector<bool> vacuum_flags;
 	vector<idx_t> merge_buffer_counts;
 };
 
+//! The state of a range scan over the keys of an ART. The row IDs of all keys in [lower_bound, upper_bound) are
+//! scanned, an empty bound is unbounded. Keys of compound indexes are concatenations of the keys of their columns, so
+//! equality predicates on the leading columns become a common prefix of both bounds.
+struct ARTIndexScanState : public IndexScanState {
+	vector<data_t> lower_bound;
+	vector<data_t> upper_bound;
+	//! True, once all keys in the range have been scanned
+	bool finished = false;
+};
+
 class ART : public BoundIndex {
 public:
 	// Index type name for the ART
@@ -52,15 +62,20 @@ public:
 	shared_ptr<array<unique_ptr<FixedSizeAllocator>, ALLOCATOR_COUNT>> allocators;
 	//! True, if the ART owns its data
 	bool owns_data;
+	//! A copy of the tree with plain leaves, which was serialized instead of the tree for older versions. It is kept
+	//! until the next serialization, as it owns the written blocks
+	unique_ptr<ART> compatible_copy;
 
-	//! Try to initialize a scan on the index with the given expression and filter
-	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction, const Expression &index_expr,
-	                                             const Expression &filter_expr);
+	//! Try to initialize a scan on the index with the given filters. The index expressions are the expressions of the
+	//! leading key columns, rewritten to match the filters. The scan uses equality predicates on a prefix of the key
+	//! columns, and range predicates on the key column that follows the prefix.
+	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction,
+	                                             const vector<unique_ptr<Expression>> &index_exprs,
+	                                             const vector<unique_ptr<Expression>> &filters);
 
-	//! Performs a lookup on the index, fetching up to max_count result IDs. Returns true if all row IDs were fetched,
-	//! and false otherwise
-	bool Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, idx_t max_count,
-	          vector<row_t> &result_ids);
+	//! Fetches the (sorted and duplicate-free) row IDs of the next keys of the scan, until at least max_count row IDs
+	//! were fetched or all keys were scanned. The row IDs of a key are never split across calls
+	void Scan(IndexScanState &state, idx_t max_count, vector<row_t> &result_ids);
 
 public:
 	//! Create a index instance of this type
@@ -88,6 +103,9 @@ public:
 
 	//! Search equal values and fetches the row IDs
 	bool SearchEqual(ARTKey &key, idx_t max_count, vector<row_t> &result_ids);
+	//! Search the first count keys while holding the index lock, and fetch the row IDs of all of them. For every row
+	//! ID, the position of its key is appended to key_positions. Empty (NULL) keys never match
+	void SearchEqual(const vector<ARTKey> &keys, idx_t count, vector<row_t> &result_ids, vector<sel_t> &key_positions);
 	//! Search equal values used for joins that do not need to fetch data
 	void SearchEqualJoinNoFetch(ARTKey &key, idx_t &result_size);
 
@@ -97,6 +115,14 @@ public:
 	//! Merge another index into this index. The lock obtained from InitializeLock must be held, and the other
 	//! index must also be locked during the merge
 	bool MergeIndexes(IndexLock &state, BoundIndex &other_index) override;
+	//! Initializes a merge operation by returning a set containing the buffer count of each fixed-size allocator
+	void InitializeMerge(ARTFlags &flags);
+	//! Increments the buffer IDs of all nodes of this ART by the buffer counts in flags. Different ARTs can be
+	//! prepared in parallel, and are then merged with MergePreparedIndexes
+	void PrepareMerge(const ARTFlags &flags);
+	//! Merge other ARTs, whose buffer IDs were already incremented by the buffer counts of this ART and of the
+	//! preceding ARTs, into this ART. Their node storage is moved first, as merging the trees can allocate buffers
+	bool MergePreparedIndexes(vector<reference<ART>> &other_arts);
 
 	//! Traverses an ART and vacuums the qualifying nodes. The lock obtained from InitializeLock must be held
 	void Vacuum(IndexLock &state) override;
@@ -128,18 +154,6 @@ private:
 	//! Erase a key from the tree (if a leaf has more than one value) or erase the leaf itself
 	void Erase(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id);
 
-	//! Returns all row IDs belonging to a key greater (or equal) than the search key
-	bool SearchGreater(ARTIndexScanState &state, ARTKey &key, bool equal, idx_t max_count, vector<row_t> &result_ids);
-	//! Returns all row IDs belonging to a key less (or equal) than the upper_bound
-	bool SearchLess(ARTIndexScanState &state, ARTKey &upper_bound, bool equal, idx_t max_count,
-	                vector<row_t> &result_ids);
-	//! Returns all row IDs belonging to a key within the range of lower_bound and upper_bound
-	bool SearchCloseRange(ARTIndexScanState &state, ARTKey &lower_bound, ARTKey &upper_bound, bool left_equal,
-	                      bool right_equal, idx_t max_count, vector<row_t> &result_ids);
-
-	//! Initializes a merge operation by returning a set containing the buffer count of each fixed-size allocator
-	void InitializeMerge(ARTFlags &flags);
-
 	//! Initializes a vacuum operation by calling the initialize operation of the respective
 	//! node allocator, and returns a vector containing either true, if the allocator at
 	//! the respective position qualifies, or false, if not
@@ -156,6 +170,8 @@ private:
 	void InitAllocators(const IndexStorageInfo &info);
 	//! STABLE STORAGE NOTE: This is for old storage files, to deserialize the allocators of the ART
 	void Deserialize(const BlockPointer &pointer);
+	//! Returns the storage information of the ART, and writes its allocator data to disk, if get_buffers is false
+	IndexStorageInfo SerializeStorageInfo(const bool get_buffers);
 	//! Initializes the serialization of the index by combining the allocator data onto partial blocks
 	void WritePartialBlocks();
 
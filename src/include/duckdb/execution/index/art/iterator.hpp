@@ -47,6 +47,11 @@ public:
 	//! Equal to operator
 	bool operator==(const ARTKey &key) const;
 
+	//! Returns the bytes of the current key
+	const vector<uint8_t> &GetBytes() const {
+		return key_bytes;
+	}
+
 private:
 	vector<uint8_t> key_bytes;
 };
@@ -61,10 +66,14 @@ public:
 	//! Scans the tree, starting at the current top node on the stack, and ending at upper_bound.
 	//! If upper_bound is the empty ARTKey, than there is no upper bound
 	bool Scan(const ARTKey &upper_bound, const idx_t max_count, vector<row_t> &result_ids, const bool equal);
+	//! Scans the tree, starting at the current top node on the stack, and ending before the (exclusive) upper_bound.
+	//! Instead of failing, stops after the leaf with which at least max_count row IDs were added. Returns true, if the
+	//! scan stopped early, in which case the current key is the key of the next leaf
+	bool ScanBatch(const ARTKey &upper_bound, const idx_t max_count, vector<row_t> &result_ids);
 	//! Finds the minimum (leaf) of the current subtree
 	void FindMinimum(const Node &node);
 	//! Finds the lower bound of the ART and adds the nodes to the stack. Returns false, if the lower
-	//! bound exceeds the maximum value of the ART
+	//! bound exceeds the maximum value of the ART. The key can be a prefix of the keys in the ART
 	bool LowerBound(const Node &node, const ARTKey &key, const bool equal, idx_t depth);
 
 private:
@@ -24,9 +24,18 @@ struct BlockPointer;
 //! The LEAF is a special node type that contains a count, up to LEAF_SIZE row IDs,
 //! and a Node pointer. If this pointer is set, then it must point to another LEAF,
 //! creating a chain of leaf nodes storing row IDs.
+//! A leaf can also be compressed, which is marked by the COMPRESSED_FLAG of its count. Then, the bytes between
+//! the count and the Node pointer hold its row IDs as unsigned LEB128 varints: the first row ID of the leaf, followed
+//! by the deltas to their predecessors. The row IDs of a chain of compressed leaves are sorted, and all leaves of a
+//! chain are either compressed or not. New leaves are always compressed, leaves with plain row IDs are only read from
+//! storage written by older versions.
 //! This class also contains functionality for nodes of type LEAF_INLINED, in which case we store the
 //! row ID directly in the node pointer.
 class Leaf {
+public:
+	//! The count of a compressed leaf has this bit set
+	static constexpr uint8_t COMPRESSED_FLAG = 0x80;
+
 public:
 	//! Delete copy constructors, as any Leaf can never own its memory
 	Leaf(const Leaf &) = delete;
@@ -42,8 +51,7 @@ public:
 public:
 	//! Inline a row ID into a node pointer
 	static void New(Node &node, const row_t row_id);
-	//! Get a new chain of leaf nodes, might cause new buffer allocations,
-	//! with the node parameter holding the tail of the chain
+	//! Get a new chain of compressed leaf nodes, might cause new buffer allocations
 	static void New(ART &art, reference<Node> &node, const row_t *row_ids, idx_t count);
 	//! Get a new leaf node without any data
 	static Leaf &New(ART &art, Node &node);
@@ -72,12 +80,40 @@ public:
 
 	//! Vacuum the leaf (chain)
 	static void Vacuum(ART &art, Node &node);
+	//! Copy the leaf chain into the target ART as a chain of leaves with plain row IDs, which older versions can read
+	static Node DecompressedCopy(ART &art, ART &target_art, const Node &node);
 
 private:
 	//! Moves the inlined row ID onto a leaf
 	static void MoveInlinedToLeaf(ART &art, Node &node);
 	//! Appends the row ID to this leaf, or creates a subsequent leaf, if this node is full
 	Leaf &Append(ART &art, const row_t row_id);
+
+	//! Replace a leaf chain with plain row IDs with a compressed leaf chain
+	static void Compress(ART &art, Node &node);
+	//! Appends all row IDs of the leaf chain to the row_ids vector
+	static void GetChainRowIds(ART &art, const Node &node, vector<row_t> &row_ids);
+	//! Writes the sorted row IDs into the compressed leaf, and into new compressed leaves, which are linked in
+	//! between the leaf and its successor
+	static void WriteCompressed(ART &art, Node &node, const row_t *row_ids, idx_t count);
+
+	//! Returns true, if the row IDs of this leaf are compressed
+	inline bool IsCompressed() const {
+		return count & COMPRESSED_FLAG;
+	}
+	//! Returns the number of row IDs in this leaf
+	inline uint8_t GetCount() const {
+		return static_cast<uint8_t>(count & ~COMPRESSED_FLAG);
+	}
+	//! Returns the first row ID of this leaf
+	row_t GetFirstRowId() const;
+	//! Appends the row IDs of this leaf to the row_ids vector
+	void DecodeRowIds(vector<row_t> &row_ids) const;
+	//! Returns true, if this leaf contains the row ID. Sets passed_row_id, if the leaf is compressed and contains a
+	//! larger row ID, as then no subsequent leaf of the chain can contain the row ID
+	bool FindRowId(const row_t row_id, bool &passed_row_id) const;
+	//! Encodes a prefix of the sorted row IDs into this leaf, and returns the number of encoded row IDs
+	idx_t EncodeRowIds(const row_t *row_ids, idx_t count);
 };
 
 } // namespace duckdb
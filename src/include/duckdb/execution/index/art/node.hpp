@@ -110,6 +110,8 @@ public:
 
 	//! Vacuum all nodes that exceed their respective vacuum thresholds
 	void Vacuum(ART &art, const ARTFlags &flags);
+	//! Copy the node and its subtree into the target ART, replacing compressed leaves with leaves with plain row IDs
+	Node DecompressedCopy(ART &art, ART &target_art) const;
 
 	//! Get the row ID (8th to 63rd bit)
 	inline row_t GetRowId() const {
@@ -48,6 +48,14 @@ public:
 		return (T *)Get(ptr, dirty);
 	}
 
+	//! Until UnpinBuffers is called, immutable accesses to segments of on-disk buffers pin the on-disk blocks instead
+	//! of copying the buffers into memory. Only read-only operations on the index can use this
+	void PinBuffersReadOnly();
+	//! Unpins all on-disk blocks that were pinned since PinBuffersReadOnly, so that the buffer manager can evict them
+	void UnpinBuffers();
+	//! Returns true, if the buffer of the IndexPointer is in memory, e.g., because it was modified
+	bool InMemory(const IndexPointer ptr) const;
+
 	//! Resets the allocator, e.g., during 'DELETE FROM table'
 	void Reset();
 
@@ -108,12 +116,23 @@ private:
 	//! Buffers qualifying for a vacuum (helper field to allow for fast NeedsVacuum checks)
 	unordered_set<idx_t> vacuum_buffers;
 
+	//! True, if immutable accesses pin the blocks of on-disk buffers
+	bool pin_read_only;
+	//! Buffers whose on-disk blocks are pinned for read-only accesses
+	vector<idx_t> read_only_buffers;
+
 private:
 	//! Returns the data_ptr_t to a segment, and sets the dirty flag of the buffer containing that segment
 	inline data_ptr_t Get(const IndexPointer ptr, const bool dirty = true) {
 		D_ASSERT(ptr.GetOffset() < available_segments_per_buffer);
 		D_ASSERT(buffers.find(ptr.GetBufferId()) != buffers.end());
 		auto &buffer = buffers.find(ptr.GetBufferId())->second;
+		if (!dirty && pin_read_only) {
+			if (!buffer.InMemory() && !buffer.PinnedReadOnly()) {
+				read_only_buffers.push_back(ptr.GetBufferId());
+			}
+			return buffer.GetReadOnly() + ptr.GetOffset() * segment_size + bitmask_offset;
+		}
 		auto buffer_ptr = buffer.Get(dirty);
 		return buffer_ptr + ptr.GetOffset() * segment_size + bitmask_offset;
 	}
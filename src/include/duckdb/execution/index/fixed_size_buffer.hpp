@@ -32,7 +32,8 @@ public:
 
 //! A fixed-size buffer holds fixed-size segments of data. It lazily deserializes a buffer, if on-disk and not
 //! yet in memory, and it only serializes dirty and non-written buffers to disk during
-//! serialization.
+//! serialization. Read-only accesses can also pin the on-disk block directly, which keeps the buffer on disk
+//! and lets the buffer manager evict the block after unpinning it.
 class FixedSizeBuffer {
 public:
 	//! Constants for fast offset calculations in the bitmask
@@ -81,6 +82,23 @@ public:
 		}
 		return buffer_handle.Ptr();
 	}
+	//! Returns a pointer to the buffer without copying an on-disk buffer into memory. Instead, the on-disk block
+	//! stays pinned until Unpin is called
+	inline data_ptr_t GetReadOnly() {
+		if (InMemory()) {
+			return buffer_handle.Ptr();
+		}
+		if (!PinnedReadOnly()) {
+			PinReadOnly();
+		}
+		return read_only_handle.Ptr() + block_pointer.offset;
+	}
+	//! Returns true, if the on-disk block is pinned for read-only accesses
+	inline bool PinnedReadOnly() const {
+		return read_only_handle.IsValid();
+	}
+	//! Unpins the on-disk block after read-only accesses
+	void Unpin();
 	//! Destroys the in-memory buffer and the on-disk block
 	void Destroy();
 	//! Serializes a buffer (if dirty or not on disk)
@@ -88,6 +106,8 @@ public:
 	               const idx_t bitmask_offset);
 	//! Pin a buffer (if not in-memory)
 	void Pin();
+	//! Pin the on-disk block of a buffer for read-only accesses
+	void PinReadOnly();
 	//! Returns the first free offset in a bitmask
 	uint32_t GetOffset(const idx_t bitmask_count);
 	//! Sets the allocation size, if dirty
@@ -98,6 +118,8 @@ private:
 	BufferHandle buffer_handle;
 	//! The block handle of the on-disk buffer
 	shared_ptr<BlockHandle> block_handle;
+	//! The buffer handle of the pinned on-disk block for read-only accesses
+	BufferHandle read_only_handle;
 
 private:
 	//! Returns the maximum non-free offset in a bitmask
@@ -13,7 +13,8 @@
 
 namespace duckdb {
 
-//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause)
+//! PhysicalStreamingWindow implements streaming window functions (i.e. without PARTITION BY and ORDER BY), such as
+//! running aggregates, aggregates over sliding ROWS frames and LAG
 class PhysicalStreamingWindow : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_WINDOW;
@@ -17,6 +17,7 @@
 #include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
+class ScanAggregateStatistics;
 
 //! PhysicalUngroupedAggregate is an aggregate operator that can only perform aggregates (1) without any groups, (2)
 //! without any DISTINCT aggregates, and (3) when all aggregates are combineable
@@ -32,6 +33,9 @@ public:
 	vector<unique_ptr<Expression>> aggregates;
 	unique_ptr<DistinctAggregateData> distinct_data;
 	unique_ptr<DistinctAggregateCollectionInfo> distinct_collection_info;
+	//! The statistics of the row groups that the table scan below skipped (if any), the aggregates over their rows are
+	//! computed from the statistics. The columns of the statistics correspond to the aggregates
+	shared_ptr<ScanAggregateStatistics> scan_statistics;
 
 public:
 	// Source interface
@@ -71,6 +75,8 @@ private:
 	void CombineDistinct(ExecutionContext &context, OperatorSinkCombineInput &input) const;
 	//! Sink the distinct aggregates
 	void SinkDistinct(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const;
+	//! Combine the aggregates over the row groups that the table scan skipped
+	void CombineScanStatistics(GlobalSinkState &gstate) const;
 };
 
 } // namespace duckdb
@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/join_filter_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+class JoinHashTable;
+class PhysicalOperator;
+
+struct JoinFilterPushdownColumn {
+	//! The join condition from which the filter is derived
+	idx_t join_condition;
+	//! The index of the column in the column ids of the probe-side table scan
+	idx_t probe_column_index;
+};
+
+struct JoinFilterPushdownTarget {
+	//! The dynamic filters of the probe-side table scan
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The columns of the table scan that can be filtered
+	vector<JoinFilterPushdownColumn> columns;
+	//! Whether or not the table scan can evaluate bloom filters
+	bool supports_bloom_filter = false;
+};
+
+struct JoinFilterGlobalState {
+	mutex lock;
+	//! Min/max statistics of the build-side keys
+	vector<BaseStatistics> key_stats;
+};
+
+struct JoinFilterLocalState {
+	//! Thread-local min/max statistics of the build-side keys
+	vector<BaseStatistics> key_stats;
+};
+
+//! JoinFilterPushdownInfo collects the min/max of the build-side keys of a hash join (and optionally a bloom filter)
+//! and pushes them as filters into the table scans on the probe side once the build side is complete
+class JoinFilterPushdownInfo {
+public:
+	//! Hash tables with more keys than this do not get a bloom filter
+	static constexpr const idx_t BLOOM_FILTER_MAX_BUILD_COUNT = 1048576;
+
+	//! The join conditions for which filters are collected
+	vector<idx_t> join_condition;
+	//! The types of the join conditions for which filters are collected
+	vector<LogicalType> condition_types;
+	//! The table scans the filters are pushed into
+	vector<JoinFilterPushdownTarget> targets;
+
+public:
+	unique_ptr<JoinFilterGlobalState> GetGlobalState(const PhysicalOperator &op) const;
+	unique_ptr<JoinFilterLocalState> GetLocalState() const;
+
+	//! Update the min/max statistics with a chunk of build-side keys
+	void Sink(DataChunk &join_keys, JoinFilterLocalState &lstate) const;
+	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
+	//! Push the collected filters into the probe-side table scans - a bloom filter is only created if a hash table is
+	//! provided
+	void PushFilters(const PhysicalOperator &op, JoinFilterGlobalState &gstate, optional_ptr<JoinHashTable> ht) const;
+
+	//! Whether or not min/max filters can be pushed for keys of the given type
+	static bool SupportsMinMaxFilter(const LogicalType &type);
+};
+
+} // namespace duckdb
@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_index_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/physical_comparison_join.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+class DuckTableEntry;
+
+//! PhysicalIndexJoin represents an index nested-loop join. For every row of the probe side (the first child), the ART
+//! index on the join keys of a base table is probed, and the matching rows are fetched from the table. The second child
+//! is the table scan of the indexed table, it is never executed.
+class PhysicalIndexJoin : public PhysicalComparisonJoin {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::INDEX_JOIN;
+
+public:
+	//! The conditions must be equality conditions in the order of the key columns of the index, their right side
+	//! is the key column of the table
+	PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> probe, unique_ptr<PhysicalOperator> table_scan,
+	                  vector<JoinCondition> cond, JoinType join_type, vector<idx_t> probe_output_columns,
+	                  const vector<idx_t> &table_output_columns, DuckTableEntry &table, string index_name,
+	                  bool probe_first, idx_t estimated_cardinality);
+
+	//! The indexed table
+	DuckTableEntry &table;
+	//! The name of the (unique) ART index that is probed
+	string index_name;
+	//! The columns of the probe side that are output
+	vector<idx_t> probe_output_columns;
+	//! The columns of the table that are fetched and output
+	vector<column_t> fetch_ids;
+	//! The types of the fetched columns
+	vector<LogicalType> fetch_types;
+	//! The types of the join keys
+	vector<LogicalType> condition_types;
+	//! The filters of the table scan on the key column of each condition (or nullptr), applied to the join keys
+	vector<unique_ptr<TableFilter>> key_filters;
+	//! True, if the columns of the probe side are output before the columns of the table
+	bool probe_first;
+
+public:
+	string ParamsToString() const override;
+
+	//! Returns the name of the unique ART index of the table scan, whose key columns are exactly the right sides of the
+	//! conditions, or an empty string. The conditions are reordered to match the key columns of the index
+	static string FindJoinIndex(ClientContext &context, PhysicalOperator &table_scan,
+	                            vector<JoinCondition> &conditions);
+
+public:
+	// Operator Interface
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+protected:
+	// CachingOperator Interface
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+
+public:
+	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
+};
+
+} // namespace duckdb
@@ -44,6 +44,8 @@ public:
 	unique_ptr<TableFilterSet> table_filters;
 	//! Currently stores any filters applied to file names (as strings)
 	ExtraOperatorInfo extra_info;
+	//! Filters that are pushed into this scan by other operators during execution (if any)
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 
 public:
 	string GetName() const override;
@@ -19,15 +19,26 @@
 namespace duckdb {
 class DuckTableEntry;
 
-//! Physical CREATE (UNIQUE) INDEX statement
+//! Physical CREATE (UNIQUE) INDEX statement. Each thread collects and sorts the keys and row IDs of its input. The key
+//! space is then split into disjoint ranges, and the ART of each range is built bottom-up from its sorted keys in
+//! parallel. As the ranges do not overlap, merging these ARTs into the global ART only touches their top levels.
 class PhysicalCreateARTIndex : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::CREATE_INDEX;
+	//! The number of key ranges per thread, more ranges than threads balance the build of their ARTs
+	static constexpr const idx_t RANGES_PER_THREAD = 4;
+	//! The minimum number of keys of a range
+	static constexpr const idx_t MIN_KEYS_PER_RANGE = 16384;
+	//! The number of keys sampled per range to find the bounds of the ranges
+	static constexpr const idx_t SAMPLES_PER_RANGE = 64;
+	//! The memory of the keys that a thread collects, before it builds an ART from them and merges it into its
+	//! thread-local ART
+	static constexpr const idx_t MAX_COLLECTED_KEY_MEMORY = 64ULL * 1024ULL * 1024ULL;
 
 public:
 	PhysicalCreateARTIndex(LogicalOperator &op, TableCatalogEntry &table, const vector<column_t> &column_ids,
 	                       unique_ptr<CreateIndexInfo> info, vector<unique_ptr<Expression>> unbound_expressions,
-	                       idx_t estimated_cardinality, const bool sorted);
+	                       idx_t estimated_cardinality);
 
 	//! The table to create the index for
 	DuckTableEntry &table;
@@ -37,12 +48,11 @@ public:
 	unique_ptr<CreateIndexInfo> info;
 	//! Unbound expressions to be used in the optimizer
 	vector<unique_ptr<Expression>> unbound_expressions;
-	//! Whether the pipeline sorts the data prior to index creation
-	const bool sorted;
 
 public:
 	//! Source interface, NOP for this operator
 	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+	double GetProgress(ClientContext &context, GlobalSourceState &gstate) const override;
 
 	bool IsSource() const override {
 		return true;
@@ -54,15 +64,11 @@ public:
 	//! Sink interface, global sink state
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
 
-	//! Sink for unsorted data: insert iteratively
-	SinkResultType SinkUnsorted(Vector &row_identifiers, OperatorSinkInput &input) const;
-	//! Sink for sorted data: build + merge
-	SinkResultType SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const;
-
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
 	                          OperatorSinkFinalizeInput &input) const override;
+	double GetSinkProgress(ClientContext &context, GlobalSinkState &gstate, double source_progress) const override;
 
 	bool IsSink() const override {
 		return true;
@@ -70,5 +76,9 @@ public:
 	bool ParallelSink() const override {
 		return true;
 	}
+
+public:
+	//! Merges the ARTs of the key ranges into the global ART, and adds it to the table and the catalog
+	void FinishIndex(ClientContext &context, GlobalSinkState &gstate) const;
 };
 } // namespace duckdb
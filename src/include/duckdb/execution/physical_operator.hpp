@@ -151,6 +151,9 @@ public:
 
 	virtual unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const;
 	virtual unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const;
+	//! Returns the current progress percentage of the pipeline that this operator is the sink of, given the progress
+	//! of its source. Sinks that do significant work after their input is exhausted can account for it here
+	virtual double GetSinkProgress(ClientContext &context, GlobalSinkState &gstate, double source_progress) const;
 
 	//! The maximum amount of memory the operator should use per thread.
 	static idx_t GetMaxThreadMemory(ClientContext &context);
@@ -188,6 +188,22 @@ public:
 	static constexpr idx_t TREE_FANOUT = 16;
 };
 
+//! Slides a single aggregate state over monotonically moving frames by removing the rows that leave the frame,
+//! and falls back to the segment tree when a frame jumps or the frames are small
+class WindowRemovableAggregator : public WindowSegmentTree {
+public:
+	WindowRemovableAggregator(AggregateObject aggr, const LogicalType &result_type, WindowAggregationMode mode_p,
+	                          const WindowExcludeMode exclude_mode_p, idx_t count);
+	~WindowRemovableAggregator() override;
+
+	unique_ptr<WindowAggregatorState> GetLocalState() const override;
+	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
+	              idx_t row_idx) const override;
+
+	//! Frames smaller than this are evaluated with the segment tree
+	static constexpr idx_t MIN_SLIDING_FRAME = TREE_FANOUT * 2;
+};
+
 class WindowDistinctAggregator : public WindowAggregator {
 public:
 	using GlobalSortStatePtr = unique_ptr<GlobalSortState>;
@@ -75,6 +75,10 @@ typedef void (*aggregate_window_t)(AggregateInputData &aggr_input_data, const Wi
 typedef void (*aggregate_wininit_t)(AggregateInputData &aggr_input_data, const WindowPartitionInput &partition,
                                     data_ptr_t g_state);
 
+//! The type used for removing rows from a simple (non-grouped) aggregate state, used for sliding window frames
+typedef void (*aggregate_remove_t)(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                   data_ptr_t state, idx_t count);
+
 typedef void (*aggregate_serialize_t)(Serializer &serializer, const optional_ptr<FunctionData> bind_data,
                                       const AggregateFunction &function);
 typedef unique_ptr<FunctionData> (*aggregate_deserialize_t)(Deserializer &deserializer, AggregateFunction &function);
@@ -149,6 +153,8 @@ public:
 	aggregate_window_t window;
 	//! The windowed aggregate custom initialization function (may be null)
 	aggregate_wininit_t window_init = nullptr;
+	//! The windowed aggregate inverse of simple_update (may be null)
+	aggregate_remove_t window_remove = nullptr;
 
 	//! The bind function (may be null)
 	bind_aggregate_function_t bind;
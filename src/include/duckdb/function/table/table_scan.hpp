@@ -11,10 +11,12 @@
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/function/built_in_functions.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
 
 namespace duckdb {
 class DuckTableEntry;
 class TableCatalogEntry;
+class ScanAggregateStatistics;
 
 struct TableScanBindData : public TableFunctionData {
 	explicit TableScanBindData(DuckTableEntry &table) : table(table), is_index_scan(false), is_create_index(false) {
@@ -27,14 +29,16 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_index_scan;
 	//! Whether or not the table scan is for index creation
 	bool is_create_index;
-	//! The row ids to fetch (in case of an index scan)
-	vector<row_t> result_ids;
+	//! The name of the index that is scanned (in case of an index scan)
+	string index_name;
+	//! The range of the index that is scanned (in case of an index scan)
+	unique_ptr<IndexScanState> index_state;
+	//! The statistics that row groups are aggregated into instead of being scanned (if any), used by an ungrouped
+	//! aggregate directly over the scan
+	shared_ptr<ScanAggregateStatistics> aggregate_statistics;
 
 public:
-	bool Equals(const FunctionData &other_p) const override {
-		auto &other = other_p.Cast<TableScanBindData>();
-		return &other.table == &table && result_ids == other.result_ids;
-	}
+	bool Equals(const FunctionData &other_p) const override;
 };
 
 //! The table scan function represents a sequential scan over one of DuckDB's base tables.
@@ -141,6 +141,15 @@ public:
 
 enum class ScanType : uint8_t { TABLE, PARQUET };
 
+//! When the global state of a table function is initialized
+enum class TableFunctionInitialization : uint8_t {
+	//! The global state is initialized eagerly (on the main thread) while the query is being scheduled
+	INITIALIZE_ON_SCHEDULE,
+	//! The global state is initialized lazily, once the pipeline that scans the function is scheduled. This allows
+	//! filters that are only known at runtime (e.g. hash join filters) to be pushed into the scan.
+	INITIALIZE_ON_EXECUTE
+};
+
 struct BindInfo {
 public:
 	explicit BindInfo(ScanType type_p) : type(type_p) {};
@@ -294,6 +303,8 @@ public:
 	//! Whether or not the table function can immediately prune out filter columns that are unused in the remainder of
 	//! the query plan, e.g., "SELECT i FROM tbl WHERE j = 42;" - j does not need to leave the table function at all
 	bool filter_prune;
+	//! When the global state of the table function is initialized
+	TableFunctionInitialization global_initialization = TableFunctionInitialization::INITIALIZE_ON_SCHEDULE;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
 
@@ -81,12 +81,17 @@ struct ClientConfig {
 	bool force_fetch_row = false;
 	//! Use range joins for inequalities, even if there are equality predicates
 	bool prefer_range_joins = false;
+	//! Use an index join whenever one is possible, instead of only when it is estimated to be cheaper
+	bool force_index_join = false;
 	//! If this context should also try to use the available replacement scans
 	//! True by default
 	bool use_replacement_scans = true;
 	//! Maximum bits allowed for using a perfect hash table (i.e. the perfect HT can hold up to 2^perfect_ht_threshold
 	//! elements)
 	idx_t perfect_ht_threshold = 12;
+	//! An index scan is used if it selects at most MAX(index_scan_max_count, index_scan_percentage * total rows) rows
+	idx_t index_scan_max_count = STANDARD_VECTOR_SIZE;
+	double index_scan_percentage = 0.001;
 	//! The maximum number of rows to accumulate before sorting ordered aggregates.
 	idx_t ordered_aggregate_threshold = (idx_t(1) << 18);
 	//! The number of rows to accumulate before flushing during a partitioned write
@@ -16,6 +16,7 @@
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/common/enums/set_scope.hpp"
+#include "duckdb/common/enums/thread_pinning_mode.hpp"
 #include "duckdb/common/enums/window_aggregation_mode.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/set.hpp"
@@ -119,6 +120,12 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether concurrent commits share a single sync of the WAL (group commit)
+	bool wal_group_commit = false;
+	//! The time in microseconds a group commit waits for other commits before syncing the WAL
+	idx_t wal_group_commit_max_delay = 0;
+	//! Whether to checkpoint a database right after replaying its WAL
+	bool checkpoint_after_wal_replay = false;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -143,6 +150,8 @@ struct DBConfigOptions {
 	idx_t maximum_memory = DConstants::INVALID_INDEX;
 	//! The maximum size of the 'temp_directory' folder when set (in bytes). Default: 90% of available disk space.
 	idx_t maximum_swap_space = DConstants::INVALID_INDEX;
+	//! Whether or not to compress blocks that are spilled to the temp_directory
+	bool temp_file_compression = true;
 	//! The maximum amount of CPU threads used by the database system. Default: all available.
 	idx_t maximum_threads = DConstants::INVALID_INDEX;
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
@@ -224,6 +233,8 @@ struct DBConfigOptions {
 	static bool debug_print_bindings; // NOLINT: debug setting
 	//! The peak allocation threshold at which to flush the allocator after completing a task (1 << 27, ~128MB)
 	idx_t allocator_flush_threshold = 134217728;
+	//! How the background threads are pinned to CPUs
+	ThreadPinningMode thread_pinning = ThreadPinningMode::NONE;
 	//! DuckDB API surface
 	string duckdb_api;
 	//! Metadata from DuckDB callers
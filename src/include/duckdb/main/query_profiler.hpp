@@ -21,6 +21,7 @@
 #include <stack>
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/deque.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 class ClientContext;
@@ -149,6 +150,11 @@ private:
 	TreeMap tree_map;
 	//! Whether or not we are running as part of a explain_analyze query
 	bool is_explain_analyze;
+	//! The statistics of the task scheduler when the query was started
+	TaskSchedulerStatistics scheduler_start;
+	//! The statistics of the task scheduler while the query was running. The statistics are shared by all queries,
+	//! so they include the tasks of concurrently running queries.
+	TaskSchedulerStatistics scheduler_statistics;
 
 public:
 	const TreeMap &GetTreeMap() const {
@@ -167,6 +173,7 @@ private:
 
 private:
 	vector<PhaseTimingItem> GetOrderedPhaseTimings() const;
+	TaskSchedulerStatistics GetSchedulerStatistics() const;
 
 	//! Check whether or not an operator type requires query profiling. If none of the ops in a query require profiling
 	//! no profiling information is output.
@@ -130,6 +130,15 @@ struct PreferRangeJoins {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ForceIndexJoin {
+	static constexpr const char *Name = "force_index_join";                                  // NOLINT
+	static constexpr const char *Description = "Force use of index joins whenever possible"; // NOLINT
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;                 // NOLINT
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugWindowMode {
 	static constexpr const char *Name = "debug_window_mode";
 	static constexpr const char *Description = "DEBUG SETTING: switch window mode to use";
@@ -556,6 +565,26 @@ struct PerfectHashThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct IndexScanMaxCountSetting {
+	static constexpr const char *Name = "index_scan_max_count";
+	static constexpr const char *Description =
+	    "The maximum number of rows an index scan selects, if index_scan_percentage * total rows is smaller";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct IndexScanPercentageSetting {
+	static constexpr const char *Name = "index_scan_percentage";
+	static constexpr const char *Description =
+	    "The maximum fraction of the rows of a table an index scan selects, if it is larger than index_scan_max_count";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct PivotFilterThreshold {
 	static constexpr const char *Name = "pivot_filter_threshold";
 	static constexpr const char *Description =
@@ -663,6 +692,16 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "Whether or not to compress blocks that are written to the temp_directory when they are compressible";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
@@ -681,6 +720,36 @@ struct UsernameSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct WALGroupCommitSetting {
+	static constexpr const char *Name = "wal_group_commit";
+	static constexpr const char *Description =
+	    "Whether concurrent commits share a single sync of the write-ahead log, instead of syncing it once per commit";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALGroupCommitMaxDelaySetting {
+	static constexpr const char *Name = "wal_group_commit_max_delay";
+	static constexpr const char *Description =
+	    "The time in microseconds a group commit waits for other commits to join before syncing the write-ahead log";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct CheckpointAfterWALReplaySetting {
+	static constexpr const char *Name = "checkpoint_after_wal_replay";
+	static constexpr const char *Description =
+	    "Whether to checkpoint a database right after its write-ahead log has been replayed when it is loaded";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct FlushAllocatorSetting {
 	static constexpr const char *Name = "allocator_flush_threshold";
 	static constexpr const char *Description =
@@ -691,6 +760,17 @@ struct FlushAllocatorSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ThreadPinningSetting {
+	static constexpr const char *Name = "thread_pinning";
+	static constexpr const char *Description =
+	    "How to pin the background threads to CPUs (Linux only): none, cores or numa. numa spreads the threads over "
+	    "the NUMA nodes, and threads steal tasks from threads on the same node first";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DuckDBApiSetting {
 	static constexpr const char *Name = "duckdb_api";
 	static constexpr const char *Description = "DuckDB API surface";
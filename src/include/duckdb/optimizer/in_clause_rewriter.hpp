@@ -12,7 +12,9 @@
 
 namespace duckdb {
 class ClientContext;
+class LogicalGet;
 class Optimizer;
+class TableFilter;
 
 class InClauseRewriter : public LogicalOperatorVisitor {
 public:
@@ -27,6 +29,11 @@ public:
 	unique_ptr<LogicalOperator> Rewrite(unique_ptr<LogicalOperator> op);
 
 	unique_ptr<Expression> VisitReplace(BoundOperatorExpression &expr, unique_ptr<Expression> *expr_ptr) override;
+
+private:
+	//! Push IN clauses over constants of a filter directly on top of a table scan into the scan as IN filters
+	unique_ptr<LogicalOperator> RewriteScanFilters(unique_ptr<LogicalOperator> op);
+	unique_ptr<TableFilter> TryCreateInFilter(Expression &expr, LogicalGet &get, idx_t &column_index);
 };
 
 } // namespace duckdb
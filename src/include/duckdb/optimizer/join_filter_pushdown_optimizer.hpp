@@ -0,0 +1,31 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_filter_pushdown_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/planner/column_binding.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+
+namespace duckdb {
+class LogicalComparisonJoin;
+class LogicalGet;
+
+//! The JoinFilterPushdownOptimizer finds hash joins whose probe-side keys originate from a table scan, and sets them up
+//! to push the min/max (and a bloom filter) of their build-side keys into that table scan during execution
+class JoinFilterPushdownOptimizer : public LogicalOperatorVisitor {
+public:
+	void VisitOperator(LogicalOperator &op) override;
+
+private:
+	void GenerateJoinFilters(LogicalComparisonJoin &join);
+	//! Find the table scan that produces the given column binding of the operator (if any)
+	static optional_ptr<LogicalGet> FindProbeTableScan(LogicalOperator &op, ColumnBinding &binding);
+};
+
+} // namespace duckdb
@@ -28,6 +28,10 @@ public:
 	//! Compute cost of a join relation set
 	double ComputeCost(DPJoinNode &left, DPJoinNode &right);
 
+	//! Returns true if probing an index on the join keys of a table once for every row of the probe side is cheaper
+	//! than a hash join, which reads the whole table
+	static bool IndexJoinIsCheaper(double probe_cardinality, double table_cardinality);
+
 	//! Cardinality Estimator used to calculate cost
 	CardinalityEstimator cardinality_estimator;
 
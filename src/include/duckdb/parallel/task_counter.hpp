@@ -31,7 +31,7 @@ public:
 		while (tasks_completed < task_count) {
 			shared_ptr<Task> task;
 			if (scheduler.GetTaskFromProducer(*token, task)) {
-				task->Execute();
+				task->Execute(TaskExecutionMode::PROCESS_ALL);
 				task.reset();
 			}
 		}
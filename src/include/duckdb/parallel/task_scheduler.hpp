@@ -13,6 +13,7 @@
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/enums/thread_pinning_mode.hpp"
 
 namespace duckdb {
 
@@ -24,6 +25,21 @@ class TaskScheduler;
 
 struct SchedulerThread;
 
+//! Counters of where the background threads found their tasks, summed over all threads
+struct TaskSchedulerStatistics {
+	//! Tasks popped from the local deque of the thread that scheduled them
+	idx_t local_tasks = 0;
+	//! Tasks taken from the shared queue
+	idx_t global_tasks = 0;
+	//! Tasks stolen from the local deque of another thread
+	idx_t stolen_tasks = 0;
+	//! The number of times a thread found no task and had to wait for one
+	idx_t idle_waits = 0;
+
+	TaskSchedulerStatistics operator-(const TaskSchedulerStatistics &other) const;
+	bool IsEmpty() const;
+};
+
 struct ProducerToken {
 	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
 	~ProducerToken();
@@ -50,8 +66,9 @@ public:
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
 	bool GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task);
-	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined
-	void ExecuteForever(atomic<bool> *marker);
+	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined.
+	//! Background threads pass their index, which identifies the local deque their scheduled tasks are pushed onto.
+	void ExecuteForever(atomic<bool> *marker, idx_t worker_idx = DConstants::INVALID_INDEX);
 	//! Run tasks until `marker` is set to false, `max_tasks` have been completed, or until there are no more tasks
 	//! available. Returns the number of tasks that were completed.
 	idx_t ExecuteTasks(atomic<bool> *marker, idx_t max_tasks);
@@ -77,6 +94,9 @@ public:
 	//! Set the allocator flush threshold
 	void SetAllocatorFlushTreshold(idx_t threshold);
 
+	//! Returns the statistics of the background threads since the database was started
+	DUCKDB_API TaskSchedulerStatistics GetStatistics();
+
 private:
 	void RelaunchThreadsInternal(int32_t n);
 
@@ -96,6 +116,8 @@ private:
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
 	atomic<int32_t> current_thread_count;
+	//! How the running background threads are pinned to CPUs
+	ThreadPinningMode current_thread_pinning;
 };
 
 } // namespace duckdb
@@ -30,6 +30,7 @@
 namespace duckdb {
 
 class ColumnDefinition;
+struct CreateTableInfo;
 struct OrderByNode;
 struct CopyInfo;
 struct CommonTableExpressionInfo;
@@ -282,6 +283,8 @@ private:
 	string TransformCollation(optional_ptr<duckdb_libpgquery::PGCollateClause> collate);
 
 	ColumnDefinition TransformColumnDefinition(duckdb_libpgquery::PGColumnDef &cdef);
+	//! Transform the options of a CREATE TABLE ... WITH (...) statement
+	void TransformTableOptions(duckdb_libpgquery::PGList &options, CreateTableInfo &info);
 	//===--------------------------------------------------------------------===//
 	// Helpers
 	//===--------------------------------------------------------------------===//
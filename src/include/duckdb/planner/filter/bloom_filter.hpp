@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
+
+namespace duckdb {
+
+//! The BloomTableFilter passes all non-NULL values whose hash might be contained in the bloom filter
+//! This is used to push the set of keys of a hash join build side into the probe side scan
+class BloomTableFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	BloomTableFilter(BloomFilter filter, idx_t key_count);
+
+	//! The bloom filter over the hashes of the values that pass
+	BloomFilter filter;
+	//! The amount of keys that were inserted into the bloom filter (used for rendering only)
+	idx_t key_count;
+
+public:
+	//! Refine the selection vector to the rows of the vector that can pass the bloom filter
+	idx_t Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count,
+	             idx_t scan_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() const override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
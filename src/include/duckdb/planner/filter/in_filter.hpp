@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/in_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! The InFilter passes all values that are equal to one of a set of constants (i.e. col IN (C1, C2, ...))
+class InFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::IN_FILTER;
+
+public:
+	explicit InFilter(vector<Value> values);
+
+	//! The sorted set of (unique, non-NULL) constants
+	vector<Value> values;
+
+public:
+	//! Whether or not an IN filter can be created for columns of the given type
+	static bool SupportsType(const LogicalType &type);
+
+	//! Refine the selection vector to the rows of the vector whose value is in the set of constants
+	idx_t Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() const override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	template <class T>
+	void TemplatedInitialize();
+	template <class T>
+	idx_t TemplatedFilter(Vector &input, UnifiedVectorFormat &vdata, SelectionVector &sel,
+	                      idx_t &approved_tuple_count) const;
+	template <class T>
+	bool Contains(const T &value) const;
+
+private:
+	//! The constants as a (flat) vector
+	unique_ptr<Vector> constants;
+	//! Open-addressing hash table over the constants: the hash and the index (+1) of the constant in every slot
+	vector<hash_t> table_hashes;
+	vector<idx_t> table_entries;
+	//! Mask to obtain a slot from a hash
+	idx_t table_mask;
+};
+
+} // namespace duckdb
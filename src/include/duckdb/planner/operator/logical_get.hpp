@@ -40,6 +40,8 @@ public:
 	vector<idx_t> projection_ids;
 	//! Filters pushed down for table scan
 	TableFilterSet table_filters;
+	//! Filters that are pushed into the scan by other operators during execution (e.g. hash join filters)
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 	//! The set of input parameters for the table function
 	vector<Value> parameters;
 	//! The set of named input parameters for the table function
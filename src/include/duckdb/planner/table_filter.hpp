@@ -11,10 +11,14 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/reference_map.hpp"
 #include "duckdb/common/enums/filter_propagate_result.hpp"
 
 namespace duckdb {
 class BaseStatistics;
+class PhysicalOperator;
 
 enum class TableFilterType : uint8_t {
 	CONSTANT_COMPARISON = 0, // constant comparison (e.g. =C, >C, >=C, <C, <=C)
@@ -22,7 +26,9 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6, // bloom filter over the hashes of a set of values (e.g. the keys of a hash join build side)
+	IN_FILTER = 7     // membership in a set of constants (e.g. IN (C1, C2, C3))
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -39,6 +45,8 @@ public:
 	//! Returns true if the statistics indicate that the segment can contain values that satisfy that filter
 	virtual FilterPropagateResult CheckStatistics(BaseStatistics &stats) = 0;
 	virtual string ToString(const string &column_name) = 0;
+	//! Creates a deep copy of this filter
+	virtual unique_ptr<TableFilter> Copy() const = 0;
 	virtual bool Equals(const TableFilter &other) const {
 		return filter_type != other.filter_type;
 	}
@@ -96,8 +104,30 @@ public:
 		return left->Equals(*right);
 	}
 
+	//! Creates a deep copy of this filter set
+	unique_ptr<TableFilterSet> Copy() const;
+
 	void Serialize(Serializer &serializer) const;
 	static TableFilterSet Deserialize(Deserializer &deserializer);
 };
 
+//! DynamicTableFilterSet holds filters that are only known during execution (e.g. the keys of a hash join build
+//! side), and that are pushed into a table scan by other operators. Filters are grouped by the operator that pushed
+//! them, so that an operator can replace its filters when it is re-executed.
+class DynamicTableFilterSet {
+public:
+	//! Remove all filters that were pushed by the given operator
+	void ClearFilters(const PhysicalOperator &op);
+	//! Push a filter on the column with the given index (relative to the column ids of the scan)
+	void PushFilter(const PhysicalOperator &op, idx_t column_index, unique_ptr<TableFilter> filter);
+	//! Whether or not any filters have been pushed
+	bool HasFilters() const;
+	//! Combine the existing (static) filters of a scan with all dynamic filters into a new filter set
+	unique_ptr<TableFilterSet> GetFinalTableFilters(optional_ptr<TableFilterSet> existing_filters) const;
+
+private:
+	mutable mutex lock;
+	reference_map_t<const PhysicalOperator, unique_ptr<TableFilterSet>> filters;
+};
+
 } // namespace duckdb
@@ -14,6 +14,8 @@ struct MemoryInformation {
 struct TemporaryFileInformation {
 	string path;
 	idx_t size;
+	//! The uncompressed size of the blocks that are stored in the file
+	idx_t spilled_size;
 };
 
 } // namespace duckdb
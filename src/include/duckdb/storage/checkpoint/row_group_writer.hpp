@@ -29,6 +29,7 @@ public:
 	}
 
 	CompressionType GetColumnCompressionType(idx_t i);
+	bool ColumnHasBloomFilter(idx_t i);
 
 	virtual void WriteColumnDataPointers(ColumnCheckpointState &column_checkpoint_state, Serializer &serializer) = 0;
 
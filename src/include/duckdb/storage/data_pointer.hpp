@@ -63,6 +63,8 @@ struct RowGroupPointer {
 	vector<MetaBlockPointer> data_pointers;
 	//! Data pointers to the delete information of the row group (if any)
 	vector<MetaBlockPointer> deletes_pointers;
+	//! Data pointers to the bloom filters of the columns - either empty or one (possibly invalid) pointer per column
+	vector<MetaBlockPointer> bloom_filter_pointers;
 };
 
 } // namespace duckdb
@@ -92,9 +92,11 @@ public:
 	//! Returns true if all pushed down filters were executed during data fetching
 	void Scan(DuckTransaction &transaction, DataChunk &result, TableScanState &state);
 
-	//! Fetch data from the specific row identifiers from the base table
+	//! Fetch data from the specific row identifiers from the base table. Rows that are not visible to the transaction
+	//! are skipped, if fetched_sel is set the positions of the fetched row identifiers are written to it
 	void Fetch(DuckTransaction &transaction, DataChunk &result, const vector<column_t> &column_ids,
-	           const Vector &row_ids, idx_t fetch_count, ColumnFetchState &state);
+	           const Vector &row_ids, idx_t fetch_count, ColumnFetchState &state,
+	           optional_ptr<SelectionVector> fetched_sel = nullptr);
 
 	//! Initializes an append to transaction-local storage
 	void InitializeLocalAppend(LocalAppendState &state, TableCatalogEntry &table, ClientContext &context,
@@ -81,6 +81,10 @@ public:
 	}
 	//! The path to the WAL, derived from the database file path
 	string GetWALPath();
+	//! Returns the statistics of the WAL replay when the database was loaded
+	const WALReplayInfo &GetWALReplayInfo() const {
+		return wal_replay_info;
+	}
 	bool InMemory();
 
 	virtual bool AutomaticCheckpoint(idx_t estimated_wal_bytes) = 0;
@@ -101,6 +105,8 @@ protected:
 	string path;
 	//! The WriteAheadLog of the storage manager
 	unique_ptr<WriteAheadLog> wal;
+	//! The statistics of the WAL replay when the database was loaded
+	WALReplayInfo wal_replay_info;
 	//! Whether or not the database is opened in read-only mode
 	bool read_only;
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
@@ -41,6 +41,8 @@ struct ColumnCheckpointInfo {
 
 public:
 	CompressionType GetCompressionType();
+	//! Whether or not a bloom filter should be constructed for the column
+	bool HasBloomFilter();
 };
 
 class ColumnData {
@@ -134,6 +136,9 @@ public:
 	virtual void UpdateColumn(TransactionData transaction, const vector<column_t> &column_path, Vector &update_vector,
 	                          row_t *row_ids, idx_t update_count, idx_t depth);
 	virtual unique_ptr<BaseStatistics> GetUpdateStatistics();
+	//! Returns the statistics of the column as they were loaded from the last checkpoint, or nullptr if the column was
+	//! appended to or updated since (its statistics might then be wider than its values)
+	virtual unique_ptr<BaseStatistics> GetCheckpointStatistics();
 
 	virtual void CommitDropColumn();
 
@@ -35,6 +35,7 @@ private:
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
 	void WriteToDisk();
 	bool HasChanges();
+	bool HasBloomFilter();
 	void WritePersistentSegments();
 
 private:
@@ -22,6 +22,7 @@
 namespace duckdb {
 class AttachedDatabase;
 class BlockManager;
+class BloomFilter;
 class ColumnData;
 class DatabaseInstance;
 class DataTable;
@@ -38,6 +39,7 @@ struct ColumnCheckpointState;
 struct RowGroupPointer;
 struct TransactionData;
 class CollectionScanState;
+class TableFilter;
 class TableFilterSet;
 struct ColumnFetchState;
 struct RowGroupAppendState;
@@ -53,11 +55,15 @@ struct RowGroupWriteInfo {
 	PartialBlockManager &manager;
 	const vector<CompressionType> &compression_types;
 	CheckpointType checkpoint_type;
+	//! For every column, whether or not a bloom filter should be constructed (empty if none should be constructed)
+	vector<bool> bloom_filter_columns;
 };
 
 struct RowGroupWriteData {
 	vector<unique_ptr<ColumnCheckpointState>> states;
 	vector<BaseStatistics> statistics;
+	//! The bloom filter version of the row group at the moment it was written
+	idx_t bloom_filter_version = 0;
 };
 
 class RowGroup : public SegmentBase<RowGroup> {
@@ -100,12 +106,15 @@ public:
 	//! Initialize a scan over this row_group
 	bool InitializeScan(CollectionScanState &state);
 	bool InitializeScanWithOffset(CollectionScanState &state, idx_t vector_offset);
-	//! Checks the given set of table filters against the row-group statistics. Returns false if the entire row group
-	//! can be skipped.
+	//! Checks the given set of table filters against the row-group statistics and bloom filters. Returns false if the
+	//! entire row group can be skipped.
 	bool CheckZonemap(TableFilterSet &filters, const vector<column_t> &column_ids);
 	//! Checks the given set of table filters against the per-segment statistics. Returns false if any segments were
 	//! skipped.
 	bool CheckZonemapSegments(CollectionScanState &state);
+	//! Adds the row group to the aggregate statistics of the scan (if any), if they cover all of its rows. Returns true
+	//! if the row group does not need to be scanned.
+	bool AggregateStatistics(CollectionScanState &state);
 	void Scan(TransactionData transaction, CollectionScanState &state, DataChunk &result);
 	void ScanCommitted(CollectionScanState &state, DataChunk &result, TableScanType type);
 
@@ -148,6 +157,8 @@ public:
 	void MergeStatistics(idx_t column_idx, const BaseStatistics &other);
 	void MergeIntoStatistics(idx_t column_idx, BaseStatistics &other);
 	unique_ptr<BaseStatistics> GetStatistics(idx_t column_idx);
+	//! Returns the bloom filter of the given column, or nullptr if the column has no (up-to-date) bloom filter
+	shared_ptr<BloomFilter> GetBloomFilter(idx_t column_idx);
 
 	void GetColumnSegmentInfo(idx_t row_group_index, vector<ColumnSegmentInfo> &result);
 
@@ -181,12 +192,24 @@ private:
 
 	bool HasUnloadedDeletes() const;
 
+	//! Checks the given table filter against the bloom filter of the column. Returns false if the filter can never
+	//! pass for this row group.
+	bool CheckBloomFilter(idx_t column_idx, const TableFilter &filter);
+	//! Drop the bloom filters of the row group - called whenever data in the row group is modified
+	void InvalidateBloomFilters();
+
 private:
 	mutex row_group_lock;
 	vector<MetaBlockPointer> column_pointers;
 	unique_ptr<atomic<bool>[]> is_loaded;
 	vector<MetaBlockPointer> deletes_pointers;
 	atomic<bool> deletes_is_loaded;
+	//! The bloom filters of the columns (if any) - either empty or one (possibly empty) entry per column
+	vector<shared_ptr<BloomFilter>> bloom_filters;
+	//! Pointers to the bloom filters that have not been loaded yet - either empty or one entry per column
+	vector<MetaBlockPointer> bloom_filter_pointers;
+	//! Incremented every time the bloom filters are invalidated
+	idx_t bloom_filter_version = 0;
 	idx_t allocation_size;
 };
 
@@ -64,8 +64,11 @@ public:
 	          const std::function<bool(DataChunk &chunk)> &fun);
 	bool Scan(DuckTransaction &transaction, const std::function<bool(DataChunk &chunk)> &fun);
 
+	//! Fetch the rows that are visible to the transaction. If fetched_sel is set, the positions of the fetched row
+	//! identifiers are written to it
 	void Fetch(TransactionData transaction, DataChunk &result, const vector<column_t> &column_ids,
-	           const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state);
+	           const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state,
+	           optional_ptr<SelectionVector> fetched_sel = nullptr);
 
 	//! Initialize an append of a variable number of rows. FinalizeAppend must be called after appending is done.
 	void InitializeAppend(TableAppendState &state);
@@ -14,6 +14,7 @@
 #include "duckdb/common/enums/scan_options.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/storage/table/segment_lock.hpp"
+#include "duckdb/transaction/transaction_data.hpp"
 
 namespace duckdb {
 class ColumnSegment;
@@ -31,6 +32,7 @@ class TableFilterSet;
 class ColumnData;
 class DuckTransaction;
 class RowGroupSegmentTree;
+class BaseStatistics;
 struct TableScanOptions;
 
 struct SegmentScanState {
@@ -142,9 +144,47 @@ private:
 	TableScanState &parent;
 };
 
+//! The statistics of the row groups that a table scan skips, because an aggregate over the scanned rows can be computed
+//! from them (e.g. SELECT MIN(i), MAX(i), COUNT(*) FROM tbl WHERE ...). A row group is only skipped if all of its rows
+//! are visible, the filters of the scan are true for all of them, and its statistics are exact, i.e. the columns were
+//! not changed since they were loaded from the last checkpoint
+class ScanAggregateStatistics {
+public:
+	//! The columns are indexes into the column ids of the scan, or DConstants::INVALID_INDEX if only the row count is
+	//! required
+	explicit ScanAggregateStatistics(vector<idx_t> columns);
+
+	//! The columns whose statistics are aggregated
+	const vector<idx_t> columns;
+
+public:
+	//! Resets the statistics for a new scan of the transaction
+	void Initialize(TransactionData transaction);
+	TransactionData GetTransaction() const {
+		return transaction;
+	}
+	//! Adds the statistics of a skipped row group, the statistics of the row count only columns are nullptr
+	void AddRowGroup(idx_t count, vector<unique_ptr<BaseStatistics>> &column_stats);
+
+	//! The number of rows in the skipped row groups
+	idx_t GetRowCount() const {
+		return row_count;
+	}
+	//! The merged statistics of a column, or nullptr if no row group was skipped
+	optional_ptr<BaseStatistics> GetStatistics(idx_t column_idx) const;
+
+private:
+	mutex lock;
+	TransactionData transaction;
+	idx_t row_count;
+	vector<unique_ptr<BaseStatistics>> statistics;
+};
+
 struct TableScanOptions {
 	//! Test config that forces fetching rows one by one instead of regular scans
 	bool force_fetch_row = false;
+	//! The statistics that row groups are aggregated into instead of being scanned (if any)
+	optional_ptr<ScanAggregateStatistics> aggregate_statistics;
 };
 
 class TableScanState {
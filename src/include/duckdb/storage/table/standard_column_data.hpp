@@ -47,6 +47,7 @@ public:
 	void UpdateColumn(TransactionData transaction, const vector<column_t> &column_path, Vector &update_vector,
 	                  row_t *row_ids, idx_t update_count, idx_t depth) override;
 	unique_ptr<BaseStatistics> GetUpdateStatistics() override;
+	unique_ptr<BaseStatistics> GetCheckpointStatistics() override;
 
 	void CommitDropColumn() override;
 
@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -38,6 +38,7 @@ public:
 	bool RemoveIndex(idx_t index);
 	idx_t GetMaxIndex();
 	bool HasFreeBlocks();
+	idx_t GetUsedBlockCount();
 
 private:
 	void SetMaxIndex(idx_t blocks);
@@ -48,6 +49,8 @@ private:
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
+	//! The size of a block on disk
+	idx_t block_size;
 };
 
 //===--------------------------------------------------------------------===//
@@ -74,8 +77,9 @@ class TemporaryFileHandle {
 	constexpr static idx_t MAX_ALLOWED_INDEX_BASE = 4000;
 
 public:
+	//! Blocks are stored in slots of slot_size bytes. Files with slots smaller than a block store compressed blocks.
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    TemporaryFileManager &manager, idx_t slot_size);
 
 public:
 	struct TemporaryFileLock {
@@ -88,8 +92,14 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
+	//! Writes an uncompressed block to the file
 	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes the first slot_size bytes of a compressed block, which holds its header and its compressed data
+	void WriteTemporaryFile(AllocatedData &compressed_block, TemporaryFileIndex index);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	idx_t GetSlotSize() const {
+		return slot_size;
+	}
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
@@ -101,6 +111,7 @@ private:
 
 private:
 	const idx_t max_allowed_index;
+	const idx_t slot_size;
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
@@ -145,6 +156,13 @@ public:
 		lock_guard<mutex> lock;
 	};
 
+	//! Compressed blocks are stored in slots that are a multiple of this size
+	constexpr static idx_t COMPRESSED_SLOT_SIZE = Storage::BLOCK_ALLOC_SIZE / 8;
+	//! The header of a compressed block: its compressed size and its checksum
+	constexpr static idx_t COMPRESSED_HEADER_SIZE = 2 * sizeof(uint64_t);
+	//! The maximum number of blocks that are not compressed after blocks turned out to be incompressible
+	constexpr static idx_t MAX_COMPRESSION_SKIP = 64;
+
 	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer);
 	bool HasTemporaryBuffer(block_id_t block_id);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer);
@@ -159,6 +177,9 @@ public:
 	void DecreaseSizeOnDisk(idx_t amount);
 
 private:
+	//! Compresses the block into a slot that is smaller than a block. Returns the size of the slot, or the size of a
+	//! block if the block is not compressed.
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_block);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
@@ -180,6 +201,10 @@ private:
 	atomic<idx_t> size_on_disk;
 	//! The max amount of disk space that can be used
 	idx_t max_swap_space;
+	//! The number of blocks that are written without trying to compress them
+	atomic<idx_t> compression_skip;
+	//! The number of blocks to skip after the next incompressible block
+	atomic<idx_t> compression_backoff;
 };
 
 } // namespace duckdb
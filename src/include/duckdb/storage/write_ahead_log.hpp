@@ -12,14 +12,18 @@
 #include "duckdb/catalog/catalog_entry/scalar_macro_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/sequence_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -37,6 +41,18 @@ class Transaction;
 class TransactionManager;
 class WriteAheadLogDeserializer;
 
+//! Statistics of the replay of a WAL when its database was loaded
+struct WALReplayInfo {
+	//! The size of the replayed WAL in bytes
+	idx_t wal_size = 0;
+	//! The number of transactions that were replayed
+	idx_t transaction_count = 0;
+	//! The time spent replaying the WAL in seconds
+	double replay_time = 0;
+	//! The time spent checkpointing the database after the replay in seconds
+	double checkpoint_time = 0;
+};
+
 //! The WriteAheadLog (WAL) is a log that is used to provide durability. Prior
 //! to committing a transaction it writes the changes the transaction made to
 //! the database to the log, which can then be replayed upon startup in case the
@@ -51,8 +67,8 @@ public:
 	bool skip_writing;
 
 public:
-	//! Replay the WAL
-	static bool Replay(AttachedDatabase &database, unique_ptr<FileHandle> handle);
+	//! Replay the WAL, the statistics of the replay are written to the info
+	static bool Replay(AttachedDatabase &database, unique_ptr<FileHandle> handle, WALReplayInfo &info);
 
 	//! Gets the total bytes written to the WAL since startup
 	idx_t GetTotalWritten();
@@ -116,6 +132,16 @@ public:
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
 	void Flush();
+	//! Flush the changes made to the WAL for a group commit. The changes are written to the file but not synced: the
+	//! commit is durable after WaitForSync has been called with the returned flush sequence number.
+	idx_t GroupCommitFlush();
+	//! Returns the sequence number of the last group commit flush
+	idx_t GetFlushSequence() const {
+		return flushed_sequence;
+	}
+	//! Wait until the WAL has been synced up to the given flush sequence number. The first waiting thread syncs the
+	//! WAL on behalf of all commits that have been flushed so far, the others wait for it.
+	void WaitForSync(idx_t sequence);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -123,6 +149,17 @@ protected:
 	AttachedDatabase &database;
 	unique_ptr<BufferedFileWriter> writer;
 	string wal_path;
+
+	//! Lock for the group commit state
+	mutex sync_lock;
+	//! Notifies the waiting commits that a sync has finished
+	std::condition_variable sync_cv;
+	//! The sequence number of the last flush that was written to the file
+	atomic<idx_t> flushed_sequence;
+	//! The sequence number of the last flush that was synced to disk
+	idx_t synced_sequence;
+	//! Whether a commit is currently syncing the WAL
+	bool sync_in_progress;
 };
 
 } // namespace duckdb
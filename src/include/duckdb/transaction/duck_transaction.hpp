@@ -66,6 +66,8 @@ public:
 	}
 
 	unique_ptr<StorageLockKey> TryGetCheckpointLock();
+	//! Takes the shared checkpoint lock of the transaction, so it can be held after the transaction is cleaned up
+	unique_ptr<StorageLockKey> ReleaseWriteLock();
 
 private:
 	DuckTransactionManager &transaction_manager;
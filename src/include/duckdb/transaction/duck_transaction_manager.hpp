@@ -11,6 +11,7 @@
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
+#include "duckdb/common/set.hpp"
 
 namespace duckdb {
 class DuckTransaction;
@@ -92,6 +93,9 @@ private:
 	vector<unique_ptr<DuckTransaction>> recently_committed_transactions;
 	//! Transactions awaiting GC
 	vector<unique_ptr<DuckTransaction>> old_transactions;
+	//! The commit timestamps of group commits whose WAL records are not synced yet. Transactions that start before the
+	//! sync do not see these commits, nor any commit that follows them
+	set<transaction_t> unsynced_commits;
 	//! The lock used for transaction operations
 	mutex transaction_lock;
 	//! The checkpoint lock
@@ -153,7 +153,7 @@ public:
 
 	void MoveStorage(DataTable &old_dt, DataTable &new_dt);
 	void FetchChunk(DataTable &table, Vector &row_ids, idx_t count, const vector<column_t> &col_ids, DataChunk &chunk,
-	                ColumnFetchState &fetch_state);
+	                ColumnFetchState &fetch_state, optional_ptr<SelectionVector> fetched_sel = nullptr);
 	TableIndexList &GetIndexes(DataTable &table);
 
 	void VerifyNewConstraint(DataTable &parent, const BoundConstraint &constraint);
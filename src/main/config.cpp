@@ -64,6 +64,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(DebugForceNoCrossProduct),
     DUCKDB_LOCAL(DebugAsOfIEJoin),
     DUCKDB_LOCAL(PreferRangeJoins),
+    DUCKDB_LOCAL(ForceIndexJoin),
     DUCKDB_GLOBAL(DebugWindowMode),
     DUCKDB_GLOBAL_LOCAL(DefaultCollationSetting),
     DUCKDB_GLOBAL(DefaultOrderSetting),
@@ -108,6 +109,8 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(OrderedAggregateThreshold),
     DUCKDB_GLOBAL(PasswordSetting),
     DUCKDB_LOCAL(PerfectHashThresholdSetting),
+    DUCKDB_LOCAL(IndexScanMaxCountSetting),
+    DUCKDB_LOCAL(IndexScanPercentageSetting),
     DUCKDB_LOCAL(PivotFilterThreshold),
     DUCKDB_LOCAL(PivotLimitSetting),
     DUCKDB_LOCAL(PreserveIdentifierCase),
@@ -121,13 +124,18 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
     DUCKDB_GLOBAL_ALIAS("user", UsernameSetting),
     DUCKDB_GLOBAL_ALIAS("wal_autocheckpoint", CheckpointThresholdSetting),
+    DUCKDB_GLOBAL(WALGroupCommitSetting),
+    DUCKDB_GLOBAL(WALGroupCommitMaxDelaySetting),
+    DUCKDB_GLOBAL(CheckpointAfterWALReplaySetting),
     DUCKDB_GLOBAL_ALIAS("worker_threads", ThreadsSetting),
     DUCKDB_GLOBAL(FlushAllocatorSetting),
+    DUCKDB_GLOBAL(ThreadPinningSetting),
     DUCKDB_GLOBAL(DuckDBApiSetting),
     DUCKDB_GLOBAL(CustomUserAgentSetting),
     DUCKDB_LOCAL(PartitionedWriteFlushThreshold),
@@ -72,6 +72,8 @@ void QueryProfiler::StartQuery(string query, bool is_explain_analyze, bool start
 	root = nullptr;
 	phase_timings.clear();
 	phase_stack.clear();
+	scheduler_start = TaskScheduler::GetScheduler(context).GetStatistics();
+	scheduler_statistics = TaskSchedulerStatistics();
 
 	main_query.Start();
 }
@@ -102,6 +104,7 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::CROSS_PRODUCT:
 	case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
 	case PhysicalOperatorType::IE_JOIN:
+	case PhysicalOperatorType::INDEX_JOIN:
 	case PhysicalOperatorType::LEFT_DELIM_JOIN:
 	case PhysicalOperatorType::RIGHT_DELIM_JOIN:
 	case PhysicalOperatorType::UNION:
@@ -133,6 +136,7 @@ void QueryProfiler::EndQuery() {
 	}
 
 	main_query.End();
+	scheduler_statistics = GetSchedulerStatistics();
 	if (root) {
 		Finalize(*root);
 	}
@@ -393,6 +397,26 @@ void QueryProfiler::QueryTreeToStream(std::ostream &ss) const {
 		ss << "└─────────────────────────────────────┘\n";
 	}
 
+	auto scheduler_stats = GetSchedulerStatistics();
+	if (!scheduler_stats.IsEmpty()) {
+		string local = "local tasks: " + to_string(scheduler_stats.local_tasks);
+		string global = "global tasks: " + to_string(scheduler_stats.global_tasks);
+		string stolen = "stolen tasks: " + to_string(scheduler_stats.stolen_tasks);
+		string idle = "idle waits: " + to_string(scheduler_stats.idle_waits);
+
+		constexpr idx_t TOTAL_BOX_WIDTH = 39;
+		ss << "┌─────────────────────────────────────┐\n";
+		ss << "│┌───────────────────────────────────┐│\n";
+		ss << "││         Scheduler Stats:          ││\n";
+		ss << "││                                   ││\n";
+		ss << "││" + DrawPadded(local, TOTAL_BOX_WIDTH - 4) + "││\n";
+		ss << "││" + DrawPadded(global, TOTAL_BOX_WIDTH - 4) + "││\n";
+		ss << "││" + DrawPadded(stolen, TOTAL_BOX_WIDTH - 4) + "││\n";
+		ss << "││" + DrawPadded(idle, TOTAL_BOX_WIDTH - 4) + "││\n";
+		ss << "│└───────────────────────────────────┘│\n";
+		ss << "└─────────────────────────────────────┘\n";
+	}
+
 	constexpr idx_t TOTAL_BOX_WIDTH = 39;
 	ss << "┌─────────────────────────────────────┐\n";
 	ss << "│┌───────────────────────────────────┐│\n";
@@ -574,6 +598,14 @@ void QueryProfiler::Print() {
 	Printer::Print(QueryTreeToString());
 }
 
+TaskSchedulerStatistics QueryProfiler::GetSchedulerStatistics() const {
+	if (!running) {
+		return scheduler_statistics;
+	}
+	// EXPLAIN ANALYZE renders the profile while the query is still running
+	return TaskScheduler::GetScheduler(context).GetStatistics() - scheduler_start;
+}
+
 vector<QueryProfiler::PhaseTimingItem> QueryProfiler::GetOrderedPhaseTimings() const {
 	vector<PhaseTimingItem> result;
 	// first sort the phases alphabetically
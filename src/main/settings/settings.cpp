@@ -1,6 +1,7 @@
 #include "duckdb/main/settings.hpp"
 
 #include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/common/enum_util.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -238,6 +239,21 @@ Value PreferRangeJoins::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).prefer_range_joins);
 }
 
+//===--------------------------------------------------------------------===//
+// Force Index Join
+//===--------------------------------------------------------------------===//
+void ForceIndexJoin::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).force_index_join = ClientConfig().force_index_join;
+}
+
+void ForceIndexJoin::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).force_index_join = input.GetValue<bool>();
+}
+
+Value ForceIndexJoin::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).force_index_join);
+}
+
 //===--------------------------------------------------------------------===//
 // Default Collation
 //===--------------------------------------------------------------------===//
@@ -1181,6 +1197,40 @@ Value PerfectHashThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(ClientConfig::GetConfig(context).perfect_ht_threshold));
 }
 
+//===--------------------------------------------------------------------===//
+// Index Scan Max Count
+//===--------------------------------------------------------------------===//
+void IndexScanMaxCountSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).index_scan_max_count = ClientConfig().index_scan_max_count;
+}
+
+void IndexScanMaxCountSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).index_scan_max_count = input.GetValue<uint64_t>();
+}
+
+Value IndexScanMaxCountSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).index_scan_max_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Index Scan Percentage
+//===--------------------------------------------------------------------===//
+void IndexScanPercentageSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).index_scan_percentage = ClientConfig().index_scan_percentage;
+}
+
+void IndexScanPercentageSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto percentage = input.GetValue<double>();
+	if (percentage < 0 || percentage > 1) {
+		throw InvalidInputException("index_scan_percentage must be within range 0 - 1");
+	}
+	ClientConfig::GetConfig(context).index_scan_percentage = percentage;
+}
+
+Value IndexScanPercentageSetting::GetSetting(const ClientContext &context) {
+	return Value::DOUBLE(ClientConfig::GetConfig(context).index_scan_percentage);
+}
+
 //===--------------------------------------------------------------------===//
 // Pivot Filter Threshold
 //===--------------------------------------------------------------------===//
@@ -1417,6 +1467,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -1460,6 +1526,54 @@ Value UsernameSetting::GetSetting(const ClientContext &context) {
 	return Value();
 }
 
+//===--------------------------------------------------------------------===//
+// WAL Group Commit
+//===--------------------------------------------------------------------===//
+void WALGroupCommitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit = input.GetValue<bool>();
+}
+
+void WALGroupCommitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit = DBConfig().options.wal_group_commit;
+}
+
+Value WALGroupCommitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.wal_group_commit);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Group Commit Max Delay
+//===--------------------------------------------------------------------===//
+void WALGroupCommitMaxDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit_max_delay = input.GetValue<uint64_t>();
+}
+
+void WALGroupCommitMaxDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit_max_delay = DBConfig().options.wal_group_commit_max_delay;
+}
+
+Value WALGroupCommitMaxDelaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_group_commit_max_delay);
+}
+
+//===--------------------------------------------------------------------===//
+// Checkpoint After WAL Replay
+//===--------------------------------------------------------------------===//
+void CheckpointAfterWALReplaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.checkpoint_after_wal_replay = input.GetValue<bool>();
+}
+
+void CheckpointAfterWALReplaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.checkpoint_after_wal_replay = DBConfig().options.checkpoint_after_wal_replay;
+}
+
+Value CheckpointAfterWALReplaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.checkpoint_after_wal_replay);
+}
+
 //===--------------------------------------------------------------------===//
 // Allocator Flush Threshold
 //===--------------------------------------------------------------------===//
@@ -1482,6 +1596,32 @@ Value FlushAllocatorSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.allocator_flush_threshold));
 }
 
+//===--------------------------------------------------------------------===//
+// Thread Pinning
+//===--------------------------------------------------------------------===//
+void ThreadPinningSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto mode = StringUtil::Lower(input.ToString());
+	if (mode == "none") {
+		config.options.thread_pinning = ThreadPinningMode::NONE;
+	} else if (mode == "cores") {
+		config.options.thread_pinning = ThreadPinningMode::CORES;
+	} else if (mode == "numa") {
+		config.options.thread_pinning = ThreadPinningMode::NUMA;
+	} else {
+		throw InvalidInputException("Unrecognized option for thread_pinning, expected none, cores or numa");
+	}
+	// the threads are relaunched with the new pinning when the next query starts
+}
+
+void ThreadPinningSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.thread_pinning = DBConfig().options.thread_pinning;
+}
+
+Value ThreadPinningSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::Lower(EnumUtil::ToString(config.options.thread_pinning)));
+}
+
 //===--------------------------------------------------------------------===//
 // DuckDBApi Setting
 //===--------------------------------------------------------------------===//
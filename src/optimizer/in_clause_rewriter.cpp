@@ -1,16 +1,24 @@
 #include "duckdb/optimizer/in_clause_rewriter.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
 #include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/operator/logical_column_data_get.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 
 namespace duckdb {
 
 unique_ptr<LogicalOperator> InClauseRewriter::Rewrite(unique_ptr<LogicalOperator> op) {
+	if (op->type == LogicalOperatorType::LOGICAL_FILTER &&
+	    op->children[0]->type == LogicalOperatorType::LOGICAL_GET) {
+		op = RewriteScanFilters(std::move(op));
+	}
 	if (op->children.size() == 1) {
 		root = std::move(op->children[0]);
 		VisitOperatorExpressions(*op);
@@ -23,6 +31,69 @@ unique_ptr<LogicalOperator> InClauseRewriter::Rewrite(unique_ptr<LogicalOperator
 	return op;
 }
 
+unique_ptr<TableFilter> InClauseRewriter::TryCreateInFilter(Expression &expr, LogicalGet &get, idx_t &column_index) {
+	if (expr.type != ExpressionType::COMPARE_IN) {
+		return nullptr;
+	}
+	auto &in_expr = expr.Cast<BoundOperatorExpression>();
+	if (in_expr.children.size() <= 2 || in_expr.children[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+		return nullptr;
+	}
+	auto &colref = in_expr.children[0]->Cast<BoundColumnRefExpression>();
+	if (colref.binding.table_index != get.table_index || colref.depth > 0) {
+		return nullptr;
+	}
+	column_index = get.column_ids[colref.binding.column_index];
+	if (column_index == COLUMN_IDENTIFIER_ROW_ID || !InFilter::SupportsType(colref.return_type)) {
+		return nullptr;
+	}
+	vector<Value> values;
+	for (idx_t i = 1; i < in_expr.children.size(); i++) {
+		auto &child = *in_expr.children[i];
+		Value value;
+		if (!child.IsFoldable() || !ExpressionExecutor::TryEvaluateScalar(context, child, value)) {
+			return nullptr;
+		}
+		if (value.IsNull()) {
+			// NULL constants can never make a filter pass: "x IN (1, NULL)" is either true or NULL
+			continue;
+		}
+		if (value.type() != colref.return_type) {
+			return nullptr;
+		}
+		values.push_back(std::move(value));
+	}
+	if (values.empty()) {
+		return nullptr;
+	}
+	return make_uniq<InFilter>(std::move(values));
+}
+
+unique_ptr<LogicalOperator> InClauseRewriter::RewriteScanFilters(unique_ptr<LogicalOperator> op) {
+	auto &filter = op->Cast<LogicalFilter>();
+	auto &get = op->children[0]->Cast<LogicalGet>();
+	if (!get.function.filter_pushdown || !get.GetTable()) {
+		// only scans over DuckDB tables evaluate IN filters
+		return op;
+	}
+	for (idx_t expr_idx = 0; expr_idx < filter.expressions.size();) {
+		// IN clauses with constants on a column of the scan: push them into the scan as an IN filter
+		idx_t column_index;
+		auto in_filter = TryCreateInFilter(*filter.expressions[expr_idx], get, column_index);
+		if (!in_filter) {
+			expr_idx++;
+			continue;
+		}
+		get.table_filters.PushFilter(column_index, std::move(in_filter));
+		filter.expressions.erase_at(expr_idx);
+	}
+	if (filter.expressions.empty() && filter.projection_map.empty()) {
+		// all filters were pushed into the scan: remove the filter
+		return std::move(op->children[0]);
+	}
+	return op;
+}
+
 unique_ptr<Expression> InClauseRewriter::VisitReplace(BoundOperatorExpression &expr, unique_ptr<Expression> *expr_ptr) {
 	if (expr.type != ExpressionType::COMPARE_IN && expr.type != ExpressionType::COMPARE_NOT_IN) {
 		return nullptr;
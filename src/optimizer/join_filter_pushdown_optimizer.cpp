@@ -0,0 +1,159 @@
+#include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
+
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+void JoinFilterPushdownOptimizer::VisitOperator(LogicalOperator &op) {
+	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		GenerateJoinFilters(op.Cast<LogicalComparisonJoin>());
+	}
+	LogicalOperatorVisitor::VisitOperator(op);
+}
+
+static bool IsEqualityJoin(LogicalComparisonJoin &join) {
+	if (join.conditions.empty()) {
+		return false;
+	}
+	for (auto &cond : join.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL &&
+		    cond.comparison != ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			return false;
+		}
+	}
+	return true;
+}
+
+optional_ptr<LogicalGet> JoinFilterPushdownOptimizer::FindProbeTableScan(LogicalOperator &op, ColumnBinding &binding) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (get.table_index != binding.table_index || !get.projected_input.empty()) {
+			return nullptr;
+		}
+		if (binding.column_index >= get.column_ids.size() ||
+		    get.column_ids[binding.column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+			return nullptr;
+		}
+		if (!get.function.filter_pushdown ||
+		    get.function.global_initialization != TableFunctionInitialization::INITIALIZE_ON_EXECUTE) {
+			// the scan must accept filters that are pushed after the plan is created
+			return nullptr;
+		}
+		return &get;
+	}
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &proj = op.Cast<LogicalProjection>();
+		if (proj.table_index != binding.table_index) {
+			return nullptr;
+		}
+		auto &expr = *proj.expressions[binding.column_index];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return nullptr;
+		}
+		binding = expr.Cast<BoundColumnRefExpression>().binding;
+		return FindProbeTableScan(*op.children[0], binding);
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+		return FindProbeTableScan(*op.children[0], binding);
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+		// we can look through the probe side of other hash joins, as long as they do not produce rows for the
+		// build side that have no match on the probe side
+		auto &join = op.Cast<LogicalComparisonJoin>();
+		switch (join.join_type) {
+		case JoinType::INNER:
+		case JoinType::LEFT:
+		case JoinType::SEMI:
+		case JoinType::ANTI:
+		case JoinType::MARK:
+			break;
+		default:
+			return nullptr;
+		}
+		if (!IsEqualityJoin(join)) {
+			// only hash joins are guaranteed to stream the probe side through the same pipeline
+			return nullptr;
+		}
+		return FindProbeTableScan(*op.children[0], binding);
+	}
+	default:
+		return nullptr;
+	}
+}
+
+void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &join) {
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+		// rows on the probe side without a match in the build side are not part of the result
+		break;
+	default:
+		return;
+	}
+	auto pushdown_info = make_uniq<JoinFilterPushdownInfo>();
+	// the physical join moves the equality conditions to the front, the filters refer to the physical conditions
+	idx_t equality_count = 0;
+	for (auto &cond : join.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL &&
+		    cond.comparison != ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			continue;
+		}
+		auto cond_idx = equality_count++;
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			continue;
+		}
+		if (cond.left->type != ExpressionType::BOUND_COLUMN_REF) {
+			continue;
+		}
+		if (cond.left->return_type.IsNested()) {
+			// table filters are not supported for nested columns
+			continue;
+		}
+		auto binding = cond.left->Cast<BoundColumnRefExpression>().binding;
+		auto get = FindProbeTableScan(*join.children[0], binding);
+		if (!get) {
+			continue;
+		}
+		bool supports_bloom_filter = get->GetTable() != nullptr;
+		if (!supports_bloom_filter && !JoinFilterPushdownInfo::SupportsMinMaxFilter(cond.left->return_type)) {
+			continue;
+		}
+		if (!get->dynamic_filters) {
+			get->dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+		}
+		// find the target for this table scan, or create a new one
+		optional_ptr<JoinFilterPushdownTarget> target;
+		for (auto &existing_target : pushdown_info->targets) {
+			if (existing_target.dynamic_filters.get() == get->dynamic_filters.get()) {
+				target = &existing_target;
+			}
+		}
+		if (!target) {
+			JoinFilterPushdownTarget new_target;
+			new_target.dynamic_filters = get->dynamic_filters;
+			new_target.supports_bloom_filter = supports_bloom_filter;
+			pushdown_info->targets.push_back(std::move(new_target));
+			target = &pushdown_info->targets.back();
+		}
+		JoinFilterPushdownColumn column;
+		column.join_condition = cond_idx;
+		column.probe_column_index = binding.column_index;
+		target->columns.push_back(column);
+
+		pushdown_info->join_condition.push_back(cond_idx);
+		pushdown_info->condition_types.push_back(cond.left->return_type);
+	}
+	if (pushdown_info->targets.empty()) {
+		return;
+	}
+	join.filter_pushdown = std::move(pushdown_info);
+}
+
+} // namespace duckdb
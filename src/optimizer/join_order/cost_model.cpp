@@ -15,4 +15,13 @@ double CostModel::ComputeCost(DPJoinNode &left, DPJoinNode &right) {
 	return join_cost + left.cost + right.cost;
 }
 
+bool CostModel::IndexJoinIsCheaper(double probe_cardinality, double table_cardinality) {
+	// a probe looks up the key in the index and fetches the row from its (compressed) column segments, which costs
+	// about as much as sequentially scanning this many rows
+	static constexpr const double INDEX_PROBE_COST = 100;
+	auto hash_join_cost = probe_cardinality + table_cardinality;
+	auto index_join_cost = probe_cardinality * INDEX_PROBE_COST;
+	return index_join_cost < hash_join_cost;
+}
+
 } // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/optimizer/statistics_propagator.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
@@ -25,6 +26,23 @@ void StatisticsPropagator::UpdateFilterStatistics(BaseStatistics &input, TableFi
 		UpdateFilterStatistics(input, constant_filter.comparison_type, constant_filter.constant);
 		break;
 	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		input.Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
+		if (!input.GetType().IsNumeric() || !NumericStats::HasMinMax(input)) {
+			break;
+		}
+		// the min and max become the smallest and largest constant (if they are within the current bounds)
+		auto &min = in_filter.values.front();
+		auto &max = in_filter.values.back();
+		if (NumericStats::Min(input) < min) {
+			NumericStats::SetMin(input, min);
+		}
+		if (max < NumericStats::Max(input)) {
+			NumericStats::SetMax(input, max);
+		}
+		break;
+	}
 	default:
 		break;
 	}
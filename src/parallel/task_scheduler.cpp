@@ -1,8 +1,10 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -12,6 +14,10 @@
 #include "lightweightsemaphore.h"
 
 #include <thread>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 #else
 #include <queue>
 #endif
@@ -35,22 +41,157 @@ struct SchedulerThread {
 typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+//! The tasks of a producer that wait in the local deques of the background threads. The tasks keep it alive, so it
+//! outlives the ProducerToken if its tasks are still queued
+struct ProducerWorkerTasks {
+	//! The number of tasks of the producer in all local deques, a producer without such tasks skips the deques
+	atomic<idx_t> count {0};
+	//! The deque the last task of the producer was pushed onto, which is searched first
+	atomic<idx_t> last_worker {0};
+};
+
+struct WorkerTask {
+	shared_ptr<Task> task;
+	//! The producer that scheduled the task
+	shared_ptr<ProducerWorkerTasks> producer;
+};
+
+//! The local task deque of a background thread. The thread pushes the tasks it schedules at the back and pops them
+//! from the back again (LIFO), so it continues with the task whose data is still in its caches. Idle threads steal
+//! the oldest tasks from the front.
+struct WorkerQueue {
+	explicit WorkerQueue(idx_t worker_idx)
+	    : worker_idx(worker_idx), task_count(0), numa_node(0), random_state(worker_idx * 2654435761ULL + 1) {
+	}
+
+	//! The index of the thread that owns this deque
+	const idx_t worker_idx;
+	mutex lock;
+	deque<WorkerTask> tasks;
+	//! The number of tasks in the deque, read without holding the lock to skip empty deques
+	atomic<idx_t> task_count;
+	//! The NUMA node the thread is pinned to, threads steal from threads on the same node first
+	atomic<idx_t> numa_node;
+	//! State of the random number generator used to pick a victim to steal from, only used by the owning thread
+	uint64_t random_state;
+
+	atomic<idx_t> local_tasks {0};
+	atomic<idx_t> global_tasks {0};
+	atomic<idx_t> stolen_tasks {0};
+	atomic<idx_t> idle_waits {0};
+
+	void Push(const shared_ptr<ProducerWorkerTasks> &producer, shared_ptr<Task> task) {
+		lock_guard<mutex> guard(lock);
+		producer->last_worker = worker_idx;
+		producer->count++;
+		tasks.push_back(WorkerTask {std::move(task), producer});
+		task_count++;
+	}
+
+	bool PopBack(shared_ptr<Task> &task) {
+		if (task_count == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.back().task);
+		tasks.back().producer->count--;
+		tasks.pop_back();
+		task_count--;
+		return true;
+	}
+
+	bool PopFront(shared_ptr<Task> &task) {
+		if (task_count == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.front().task);
+		tasks.front().producer->count--;
+		tasks.pop_front();
+		task_count--;
+		return true;
+	}
+
+	bool PopFromProducer(ProducerWorkerTasks &producer, shared_ptr<Task> &task) {
+		if (task_count == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		// the tasks of the producer are usually the most recently pushed ones
+		for (auto it = tasks.rbegin(); it != tasks.rend(); it++) {
+			if (it->producer.get() == &producer) {
+				task = std::move(it->task);
+				producer.count--;
+				tasks.erase(std::next(it).base());
+				task_count--;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	idx_t NextRandom() {
+		// xorshift64
+		random_state ^= random_state << 13;
+		random_state ^= random_state >> 7;
+		random_state ^= random_state << 17;
+		return random_state;
+	}
+};
+
 struct ConcurrentQueue {
+	//! Background threads beyond this number do not get a local deque, and only use the shared queue
+	static constexpr idx_t MAX_WORKER_QUEUES = 1024;
+
+	ConcurrentQueue() : worker_queues(MAX_WORKER_QUEUES), worker_queue_count(0) {
+	}
+
 	concurrent_queue_t q;
 	lightweight_semaphore_t semaphore;
+	//! The local deques of the background threads. The vector is never resized, so other threads can access the first
+	//! "worker_queue_count" entries while new deques are added. Deques are kept when their thread is stopped, so the
+	//! tasks that remain in them can still be stolen.
+	vector<unique_ptr<WorkerQueue>> worker_queues;
+	atomic<idx_t> worker_queue_count;
 
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	//! Dequeue a task for a background thread (if "worker" is set) or an external thread
+	bool Dequeue(optional_ptr<WorkerQueue> worker, shared_ptr<Task> &task);
+	bool Steal(optional_ptr<WorkerQueue> thief, shared_ptr<Task> &task);
+	optional_ptr<WorkerQueue> GetWorkerQueue(idx_t worker_idx);
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	explicit QueueProducerToken(ConcurrentQueue &queue)
+	    : queue_token(queue.q), worker_tasks(make_shared_ptr<ProducerWorkerTasks>()) {
 	}
 
 	duckdb_moodycamel::ProducerToken queue_token;
+	shared_ptr<ProducerWorkerTasks> worker_tasks;
+};
+
+//! The background thread that is running on this thread, if any
+struct CurrentWorker {
+	optional_ptr<ConcurrentQueue> queue;
+	optional_ptr<WorkerQueue> worker;
 };
 
+static thread_local CurrentWorker current_worker;
+
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+	if (current_worker.queue.get() == this) {
+		// tasks scheduled by a background thread are pushed onto its own deque
+		current_worker.worker->Push(token.token->worker_tasks, std::move(task));
+		semaphore.signal();
+		return;
+	}
 	lock_guard<mutex> producer_lock(token.producer_lock);
 	if (q.enqueue(token.token->queue_token, std::move(task))) {
 		semaphore.signal();
@@ -60,8 +201,77 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 }
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	{
+		lock_guard<mutex> producer_lock(token.producer_lock);
+		if (q.try_dequeue_from_producer(token.token->queue_token, task)) {
+			return true;
+		}
+	}
+	// the tasks of the producer might have been scheduled by background threads onto their local deques
+	auto &worker_tasks = *token.token->worker_tasks;
+	if (worker_tasks.count == 0) {
+		return false;
+	}
+	auto queue_count = worker_queue_count.load();
+	auto start = worker_tasks.last_worker.load();
+	for (idx_t i = 0; i < queue_count; i++) {
+		if (worker_queues[(start + i) % queue_count]->PopFromProducer(worker_tasks, task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::Dequeue(optional_ptr<WorkerQueue> worker, shared_ptr<Task> &task) {
+	if (!worker) {
+		return q.try_dequeue(task) || Steal(nullptr, task);
+	}
+	if (worker->PopBack(task)) {
+		worker->local_tasks++;
+		return true;
+	}
+	if (q.try_dequeue(task)) {
+		worker->global_tasks++;
+		return true;
+	}
+	if (Steal(worker, task)) {
+		worker->stolen_tasks++;
+		return true;
+	}
+	return false;
+}
+
+bool ConcurrentQueue::Steal(optional_ptr<WorkerQueue> thief, shared_ptr<Task> &task) {
+	auto queue_count = worker_queue_count.load();
+	if (queue_count == 0) {
+		return false;
+	}
+	// start at a random victim, so idle threads do not all contend on the same deque
+	auto start = thief ? thief->NextRandom() % queue_count : 0;
+	// first try the threads on the same NUMA node as the thief, then all others
+	for (idx_t pass = 0; pass < 2; pass++) {
+		for (idx_t i = 0; i < queue_count; i++) {
+			auto &victim = *worker_queues[(start + i) % queue_count];
+			if (&victim == thief.get()) {
+				continue;
+			}
+			bool same_node = !thief || victim.numa_node == thief->numa_node;
+			if (same_node != (pass == 0)) {
+				continue;
+			}
+			if (victim.PopFront(task)) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+optional_ptr<WorkerQueue> ConcurrentQueue::GetWorkerQueue(idx_t worker_idx) {
+	if (worker_idx >= worker_queue_count.load()) {
+		return nullptr;
+	}
+	return worker_queues[worker_idx].get();
 }
 
 #else
@@ -104,7 +314,7 @@ ProducerToken::~ProducerToken() {
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
     : db(db), queue(make_uniq<ConcurrentQueue>()),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold), requested_thread_count(0),
-      current_thread_count(1) {
+      current_thread_count(1), current_thread_pinning(ThreadPinningMode::NONE) {
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -139,14 +349,24 @@ bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &
 	return queue->DequeueFromProducer(token, task);
 }
 
-void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
+void TaskScheduler::ExecuteForever(atomic<bool> *marker, idx_t worker_idx) {
 #ifndef DUCKDB_NO_THREADS
+	auto worker = queue->GetWorkerQueue(worker_idx);
+	if (worker) {
+		current_worker.queue = queue.get();
+		current_worker.worker = worker;
+	}
 	shared_ptr<Task> task;
 	// loop until the marker is set to false
 	while (*marker) {
-		// wait for a signal with a timeout
-		queue->semaphore.wait();
-		if (queue->q.try_dequeue(task)) {
+		// every scheduled task signals the semaphore: only wait if no task was scheduled since we last looked
+		if (!queue->semaphore.tryWait()) {
+			if (worker) {
+				worker->idle_waits++;
+			}
+			queue->semaphore.wait();
+		}
+		if (queue->Dequeue(worker, task)) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -166,6 +386,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 			Allocator::ThreadFlush(allocator_flush_threshold);
 		}
 	}
+	current_worker = CurrentWorker();
 #else
 	throw NotImplementedException("DuckDB was compiled without threads! Background thread loop is not allowed.");
 #endif
@@ -177,7 +398,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(nullptr, task)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -207,7 +428,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(nullptr, task)) {
 			return;
 		}
 		try {
@@ -234,8 +455,110 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
-	scheduler->ExecuteForever(marker);
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, idx_t worker_idx) {
+	scheduler->ExecuteForever(marker, worker_idx);
+}
+
+#if defined(__linux__)
+static vector<idx_t> ParseCPUList(const string &cpu_list) {
+	// e.g. "0-3,8-11"
+	vector<idx_t> result;
+	for (auto &range : StringUtil::Split(StringUtil::Replace(cpu_list, "\n", ""), ',')) {
+		auto bounds = StringUtil::Split(range, '-');
+		if (bounds.empty() || bounds.size() > 2) {
+			continue;
+		}
+		auto start = std::stoull(bounds[0]);
+		auto end = bounds.size() == 2 ? std::stoull(bounds[1]) : start;
+		for (auto cpu = start; cpu <= end; cpu++) {
+			result.push_back(cpu);
+		}
+	}
+	return result;
+}
+
+//! Returns the CPUs this process may run on, grouped by NUMA node
+static vector<vector<idx_t>> GetNumaNodes() {
+	cpu_set_t allowed;
+	CPU_ZERO(&allowed);
+	if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+		return vector<vector<idx_t>>();
+	}
+	vector<vector<idx_t>> nodes;
+	auto fs = FileSystem::CreateLocal();
+	for (idx_t node_idx = 0;; node_idx++) {
+		auto path = "/sys/devices/system/node/node" + to_string(node_idx) + "/cpulist";
+		vector<idx_t> cpus;
+		try {
+			auto handle = fs->OpenFile(path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+			if (!handle) {
+				break;
+			}
+			cpus = ParseCPUList(handle->ReadLine());
+		} catch (std::exception &ex) {
+			break;
+		}
+		vector<idx_t> node;
+		for (auto cpu : cpus) {
+			if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) {
+				node.push_back(cpu);
+			}
+		}
+		if (!node.empty()) {
+			nodes.push_back(std::move(node));
+		}
+	}
+	if (nodes.empty()) {
+		// no NUMA information available: all CPUs are on a single node
+		vector<idx_t> node;
+		for (idx_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+			if (CPU_ISSET(cpu, &allowed)) {
+				node.push_back(cpu);
+			}
+		}
+		if (!node.empty()) {
+			nodes.push_back(std::move(node));
+		}
+	}
+	return nodes;
+}
+
+static void PinThread(thread &worker_thread, const vector<idx_t> &cpus) {
+	if (cpus.empty()) {
+		return;
+	}
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto cpu : cpus) {
+		CPU_SET(cpu, &cpu_set);
+	}
+	// pinning is best effort: if it fails the thread can run on any CPU
+	pthread_setaffinity_np(worker_thread.native_handle(), sizeof(cpu_set), &cpu_set);
+}
+#endif
+
+//! Returns the CPUs the "worker_idx"th background thread is pinned to, and the NUMA node they are on
+static vector<idx_t> GetWorkerCPUs(idx_t worker_idx, ThreadPinningMode mode, const vector<vector<idx_t>> &numa_nodes,
+                                   idx_t &numa_node) {
+	numa_node = 0;
+	if (mode == ThreadPinningMode::NONE || numa_nodes.empty()) {
+		return vector<idx_t>();
+	}
+	if (mode == ThreadPinningMode::NUMA) {
+		// spread the threads round-robin over the nodes
+		numa_node = worker_idx % numa_nodes.size();
+		return numa_nodes[numa_node];
+	}
+	idx_t cpu_count = 0;
+	for (auto &node : numa_nodes) {
+		cpu_count += node.size();
+	}
+	// fill up the nodes one after the other, so threads with nearby indexes share a node
+	auto cpu_idx = worker_idx % cpu_count;
+	for (numa_node = 0; cpu_idx >= numa_nodes[numa_node].size(); numa_node++) {
+		cpu_idx -= numa_nodes[numa_node].size();
+	}
+	return vector<idx_t> {numa_nodes[numa_node][cpu_idx]};
 }
 #endif
 
@@ -263,6 +586,34 @@ void TaskScheduler::SetThreads(idx_t total_threads, idx_t external_threads) {
 void TaskScheduler::SetAllocatorFlushTreshold(idx_t threshold) {
 }
 
+TaskSchedulerStatistics TaskSchedulerStatistics::operator-(const TaskSchedulerStatistics &other) const {
+	TaskSchedulerStatistics result;
+	result.local_tasks = local_tasks - other.local_tasks;
+	result.global_tasks = global_tasks - other.global_tasks;
+	result.stolen_tasks = stolen_tasks - other.stolen_tasks;
+	result.idle_waits = idle_waits - other.idle_waits;
+	return result;
+}
+
+bool TaskSchedulerStatistics::IsEmpty() const {
+	return local_tasks == 0 && global_tasks == 0 && stolen_tasks == 0 && idle_waits == 0;
+}
+
+TaskSchedulerStatistics TaskScheduler::GetStatistics() {
+	TaskSchedulerStatistics result;
+#ifndef DUCKDB_NO_THREADS
+	auto queue_count = queue->worker_queue_count.load();
+	for (idx_t i = 0; i < queue_count; i++) {
+		auto &worker = *queue->worker_queues[i];
+		result.local_tasks += worker.local_tasks;
+		result.global_tasks += worker.global_tasks;
+		result.stolen_tasks += worker.stolen_tasks;
+		result.idle_waits += worker.idle_waits;
+	}
+#endif
+	return result;
+}
+
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	typedef std::make_signed<std::size_t>::type ssize_t;
@@ -286,12 +637,13 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 #ifndef DUCKDB_NO_THREADS
 	auto &config = DBConfig::GetConfig(db);
 	auto new_thread_count = NumericCast<idx_t>(n);
-	if (threads.size() == new_thread_count) {
+	auto thread_pinning = config.options.thread_pinning;
+	if (threads.size() == new_thread_count && thread_pinning == current_thread_pinning) {
 		current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 		return;
 	}
-	if (threads.size() > new_thread_count) {
-		// we are reducing the number of threads: clear all threads first
+	if (threads.size() > new_thread_count || thread_pinning != current_thread_pinning) {
+		// we are reducing the number of threads or pinning them differently: clear all threads first
 		for (idx_t i = 0; i < threads.size(); i++) {
 			*markers[i] = false;
 		}
@@ -306,24 +658,45 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 	}
 	if (threads.size() < new_thread_count) {
 		// we are increasing the number of threads: launch them and run tasks on them
-		idx_t create_new_threads = new_thread_count - threads.size();
-		for (idx_t i = 0; i < create_new_threads; i++) {
+		vector<vector<idx_t>> numa_nodes;
+#if defined(__linux__)
+		if (thread_pinning != ThreadPinningMode::NONE) {
+			numa_nodes = GetNumaNodes();
+		}
+#endif
+		while (threads.size() < new_thread_count) {
+			auto worker_idx = threads.size();
+			if (worker_idx < ConcurrentQueue::MAX_WORKER_QUEUES && worker_idx == queue->worker_queue_count) {
+				// the deques of threads that were stopped are reused, this thread is the first with this index
+				queue->worker_queues[worker_idx] = make_uniq<WorkerQueue>(worker_idx);
+				queue->worker_queue_count++;
+			}
+			idx_t numa_node;
+			auto cpus = GetWorkerCPUs(worker_idx, thread_pinning, numa_nodes, numa_node);
+			auto worker = queue->GetWorkerQueue(worker_idx);
+			if (worker) {
+				worker->numa_node = numa_node;
+			}
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), worker_idx);
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
 				break;
 			}
+#if defined(__linux__)
+			PinThread(*worker_thread, cpus);
+#endif
 			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread));
 
 			threads.push_back(std::move(thread_wrapper));
 			markers.push_back(std::move(marker));
 		}
 	}
+	current_thread_pinning = thread_pinning;
 	current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 #endif
 }
@@ -21,6 +21,7 @@ ColumnDefinition ColumnDefinition::Copy() const {
 	copy.storage_oid = storage_oid;
 	copy.expression = expression ? expression->Copy() : nullptr;
 	copy.compression_type = compression_type;
+	copy.bloom_filter = bloom_filter;
 	copy.category = category;
 	copy.comment = comment;
 	copy.tags = tags;
@@ -86,6 +87,14 @@ void ColumnDefinition::SetCompressionType(duckdb::CompressionType compression_ty
 	this->compression_type = compression_type;
 }
 
+bool ColumnDefinition::HasBloomFilter() const {
+	return bloom_filter;
+}
+
+void ColumnDefinition::SetBloomFilter(bool bloom_filter) {
+	this->bloom_filter = bloom_filter;
+}
+
 const storage_t &ColumnDefinition::StorageOid() const {
 	return storage_oid;
 }
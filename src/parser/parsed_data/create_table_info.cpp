@@ -49,7 +49,17 @@ string CreateTableInfo::ToString() const {
 	if (query != nullptr) {
 		ret += " AS " + query->ToString();
 	} else {
-		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints) + ";";
+		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints);
+		vector<string> bloom_filter_columns;
+		for (auto &column : columns.Logical()) {
+			if (column.HasBloomFilter()) {
+				bloom_filter_columns.push_back(column.Name());
+			}
+		}
+		if (!bloom_filter_columns.empty()) {
+			ret += " WITH (bloom_filter = " + Value(StringUtil::Join(bloom_filter_columns, ", ")).ToSQLString() + ")";
+		}
+		ret += ";";
 	}
 	return ret;
 }
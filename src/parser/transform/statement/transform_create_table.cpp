@@ -3,6 +3,7 @@
 #include "duckdb/parser/transformer.hpp"
 #include "duckdb/parser/constraint.hpp"
 #include "duckdb/parser/expression/collate_expression.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/catalog/catalog_entry/table_column_type.hpp"
 
 namespace duckdb {
@@ -66,6 +67,40 @@ ColumnDefinition Transformer::TransformColumnDefinition(duckdb_libpgquery::PGCol
 	return ColumnDefinition(colname, target_type);
 }
 
+void Transformer::TransformTableOptions(duckdb_libpgquery::PGList &options, CreateTableInfo &info) {
+	duckdb_libpgquery::PGListCell *cell;
+	for_each_cell(cell, options.head) {
+		auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(cell->data.ptr_value);
+		auto option_name = StringUtil::Lower(def_elem->defname);
+		if (option_name != "bloom_filter") {
+			continue;
+		}
+		if (!def_elem->arg) {
+			throw ParserException("The \"bloom_filter\" option expects a comma-separated list of columns");
+		}
+		auto val = TransformValue(*PGPointerCast<duckdb_libpgquery::PGValue>(def_elem->arg))->value;
+		if (val.type().id() != LogicalTypeId::VARCHAR) {
+			throw ParserException("The \"bloom_filter\" option expects a comma-separated list of columns");
+		}
+		for (auto &column_name : StringUtil::Split(StringValue::Get(val), ',')) {
+			StringUtil::Trim(column_name);
+			if (!info.columns.ColumnExists(column_name)) {
+				throw ParserException("Column \"%s\" referenced in the \"bloom_filter\" option does not exist",
+				                      column_name);
+			}
+			auto &column = info.columns.GetColumnMutable(column_name);
+			if (column.Generated()) {
+				throw ParserException("Generated column \"%s\" cannot have a bloom filter", column_name);
+			}
+			if (column.Type().IsNested()) {
+				throw ParserException("Column \"%s\" of type %s cannot have a bloom filter", column_name,
+				                      column.Type().ToString());
+			}
+			column.SetBloomFilter(true);
+		}
+	}
+}
+
 unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery::PGCreateStmt &stmt) {
 	auto result = make_uniq<CreateStatement>();
 	auto info = make_uniq<CreateTableInfo>();
@@ -124,6 +159,10 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery:
 		throw ParserException("Table must have at least one column!");
 	}
 
+	if (stmt.options) {
+		TransformTableOptions(*stmt.options, *info);
+	}
+
 	result->info = std::move(info);
 	return result;
 }
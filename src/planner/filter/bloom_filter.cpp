@@ -0,0 +1,60 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+BloomTableFilter::BloomTableFilter(BloomFilter filter_p, idx_t key_count_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), filter(std::move(filter_p)), key_count(key_count_p) {
+}
+
+idx_t BloomTableFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                               idx_t &approved_tuple_count, idx_t scan_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(scan_count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			// NULL values never pass
+			continue;
+		}
+		if (filter.Lookup(hash_data[hdata.sel->get_index(idx)])) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+FilterPropagateResult BloomTableFilter::CheckStatistics(BaseStatistics &stats) {
+	// the bloom filter contains hashes only: we cannot use min/max statistics to prune
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomTableFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER(" + to_string(key_count) + " keys)";
+}
+
+unique_ptr<TableFilter> BloomTableFilter::Copy() const {
+	return make_uniq<BloomTableFilter>(filter, key_count);
+}
+
+bool BloomTableFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomTableFilter>();
+	return other.key_count == key_count && other.filter.Equals(filter);
+}
+
+} // namespace duckdb
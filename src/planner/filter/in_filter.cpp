@@ -0,0 +1,257 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+InFilter::InFilter(vector<Value> values_p) : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)) {
+	if (values.empty()) {
+		throw InternalException("InFilter requires at least one constant");
+	}
+	for (auto &val : values) {
+		if (val.IsNull()) {
+			throw InternalException("InFilter constants cannot be NULL");
+		}
+		if (val.type() != values[0].type()) {
+			throw InternalException("InFilter constants must all have the same type");
+		}
+	}
+	std::sort(values.begin(), values.end());
+	values.erase(std::unique(values.begin(), values.end()), values.end());
+
+	// build the hash table over the constants
+	constants = make_uniq<Vector>(values[0].type(), values.size());
+	for (idx_t i = 0; i < values.size(); i++) {
+		constants->SetValue(i, values[i]);
+	}
+	auto capacity = NextPowerOfTwo(values.size() * 2);
+	table_mask = capacity - 1;
+	table_hashes.resize(capacity, 0);
+	table_entries.resize(capacity, 0);
+	switch (values[0].type().InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		TemplatedInitialize<int8_t>();
+		break;
+	case PhysicalType::INT16:
+		TemplatedInitialize<int16_t>();
+		break;
+	case PhysicalType::INT32:
+		TemplatedInitialize<int32_t>();
+		break;
+	case PhysicalType::INT64:
+		TemplatedInitialize<int64_t>();
+		break;
+	case PhysicalType::INT128:
+		TemplatedInitialize<hugeint_t>();
+		break;
+	case PhysicalType::UINT8:
+		TemplatedInitialize<uint8_t>();
+		break;
+	case PhysicalType::UINT16:
+		TemplatedInitialize<uint16_t>();
+		break;
+	case PhysicalType::UINT32:
+		TemplatedInitialize<uint32_t>();
+		break;
+	case PhysicalType::UINT64:
+		TemplatedInitialize<uint64_t>();
+		break;
+	case PhysicalType::UINT128:
+		TemplatedInitialize<uhugeint_t>();
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedInitialize<float>();
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedInitialize<double>();
+		break;
+	case PhysicalType::VARCHAR:
+		TemplatedInitialize<string_t>();
+		break;
+	default:
+		throw InternalException("Unsupported type \"%s\" for InFilter", values[0].type().ToString());
+	}
+}
+
+bool InFilter::SupportsType(const LogicalType &type) {
+	auto physical_type = type.InternalType();
+	return TypeIsNumeric(physical_type) || physical_type == PhysicalType::BOOL || physical_type == PhysicalType::VARCHAR;
+}
+
+template <class T>
+void InFilter::TemplatedInitialize() {
+	auto data = FlatVector::GetData<T>(*constants);
+	for (idx_t i = 0; i < values.size(); i++) {
+		auto hash = Hash<T>(data[i]);
+		auto slot = hash & table_mask;
+		while (table_entries[slot] != 0) {
+			slot = (slot + 1) & table_mask;
+		}
+		table_hashes[slot] = hash;
+		table_entries[slot] = i + 1;
+	}
+}
+
+template <class T>
+bool InFilter::Contains(const T &value) const {
+	auto data = FlatVector::GetData<T>(*constants);
+	auto hash = Hash<T>(value);
+	for (auto slot = hash & table_mask; table_entries[slot] != 0; slot = (slot + 1) & table_mask) {
+		if (table_hashes[slot] == hash && Equals::Operation<T>(data[table_entries[slot] - 1], value)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+template <class T>
+idx_t InFilter::TemplatedFilter(Vector &input, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                                idx_t &approved_tuple_count) const {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+
+	if (input.GetVectorType() == VectorType::DICTIONARY_VECTOR &&
+	    DictionaryVector::Child(input).GetVectorType() == VectorType::FLAT_VECTOR) {
+		auto dictionary_size = DictionaryVector::DictionarySize(input);
+		if (dictionary_size.IsValid() && dictionary_size.GetIndex() <= approved_tuple_count) {
+			// the dictionary is smaller than the amount of rows: probe every dictionary entry only once
+			vector<bool> dictionary_matches(dictionary_size.GetIndex());
+			for (idx_t i = 0; i < dictionary_size.GetIndex(); i++) {
+				dictionary_matches[i] = Contains<T>(data[i]);
+			}
+			for (idx_t i = 0; i < approved_tuple_count; i++) {
+				auto idx = sel.get_index(i);
+				auto dictionary_idx = vdata.sel->get_index(idx);
+				if (vdata.validity.RowIsValid(dictionary_idx) && dictionary_matches[dictionary_idx]) {
+					result_sel.set_index(result_count++, idx);
+				}
+			}
+			sel.Initialize(result_sel);
+			approved_tuple_count = result_count;
+			return result_count;
+		}
+	}
+
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto vector_idx = vdata.sel->get_index(idx);
+		if (vdata.validity.RowIsValid(vector_idx) && Contains<T>(data[vector_idx])) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+idx_t InFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                       idx_t &approved_tuple_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	switch (vector.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		return TemplatedFilter<int8_t>(vector, vdata, sel, approved_tuple_count);
+	case PhysicalType::INT16:
+		return TemplatedFilter<int16_t>(vector, vdata, sel, approved_tuple_count);
+	case PhysicalType::INT32:
+		return TemplatedFilter<int32_t>(vector, vdata, sel, approved_tuple_count);
+	case PhysicalType::INT64:
+		return TemplatedFilter<int64_t>(vector, vdata, sel, approved_tuple_count);
+	case PhysicalType::INT128:
+		return TemplatedFilter<hugeint_t>(vector, vdata, sel, approved_tuple_count);
+	case PhysicalType::UINT8:
+		return TemplatedFilter<uint8_t>(vector, vdata, sel, approved_tuple_count);
+	case PhysicalType::UINT16:
+		return TemplatedFilter<uint16_t>(vector, vdata, sel, approved_tuple_count);
+	case PhysicalType::UINT32:
+		return TemplatedFilter<uint32_t>(vector, vdata, sel, approved_tuple_count);
+	case PhysicalType::UINT64:
+		return TemplatedFilter<uint64_t>(vector, vdata, sel, approved_tuple_count);
+	case PhysicalType::UINT128:
+		return TemplatedFilter<uhugeint_t>(vector, vdata, sel, approved_tuple_count);
+	case PhysicalType::FLOAT:
+		return TemplatedFilter<float>(vector, vdata, sel, approved_tuple_count);
+	case PhysicalType::DOUBLE:
+		return TemplatedFilter<double>(vector, vdata, sel, approved_tuple_count);
+	case PhysicalType::VARCHAR:
+		return TemplatedFilter<string_t>(vector, vdata, sel, approved_tuple_count);
+	default:
+		throw InternalException("Unsupported type \"%s\" for InFilter", vector.GetType().ToString());
+	}
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	D_ASSERT(values[0].type().id() == stats.GetType().id());
+	switch (values[0].type().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE: {
+		if (!NumericStats::HasMinMax(stats)) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		// the constants are sorted: find the smallest constant that is >= min, and check if it is <= max
+		auto min = NumericStats::Min(stats);
+		auto max = NumericStats::Max(stats);
+		auto entry = std::lower_bound(values.begin(), values.end(), min);
+		if (entry == values.end() || max < *entry) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		if (min == max && !stats.CanHaveNull()) {
+			// all values are equal to a constant in the set
+			return FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	case PhysicalType::VARCHAR:
+		// string statistics are truncated: check every constant individually
+		for (auto &val : values) {
+			auto result = StringStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, StringValue::Get(val));
+			if (result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+string InFilter::ToString(const string &column_name) {
+	string in_list;
+	for (auto &val : values) {
+		if (!in_list.empty()) {
+			in_list += ", ";
+		}
+		in_list += val.ToSQLString();
+	}
+	return column_name + " IN (" + in_list + ")";
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+} // namespace duckdb
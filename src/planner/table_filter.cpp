@@ -24,4 +24,48 @@ void TableFilterSet::PushFilter(idx_t column_index, unique_ptr<TableFilter> filt
 	}
 }
 
+unique_ptr<TableFilterSet> TableFilterSet::Copy() const {
+	auto result = make_uniq<TableFilterSet>();
+	for (auto &entry : filters) {
+		result->filters[entry.first] = entry.second->Copy();
+	}
+	return result;
+}
+
+void DynamicTableFilterSet::ClearFilters(const PhysicalOperator &op) {
+	lock_guard<mutex> l(lock);
+	filters.erase(op);
+}
+
+void DynamicTableFilterSet::PushFilter(const PhysicalOperator &op, idx_t column_index, unique_ptr<TableFilter> filter) {
+	lock_guard<mutex> l(lock);
+	auto entry = filters.find(op);
+	optional_ptr<TableFilterSet> filter_ptr;
+	if (entry == filters.end()) {
+		auto filter_set = make_uniq<TableFilterSet>();
+		filter_ptr = filter_set.get();
+		filters[op] = std::move(filter_set);
+	} else {
+		filter_ptr = entry->second.get();
+	}
+	filter_ptr->PushFilter(column_index, std::move(filter));
+}
+
+bool DynamicTableFilterSet::HasFilters() const {
+	lock_guard<mutex> l(lock);
+	return !filters.empty();
+}
+
+unique_ptr<TableFilterSet> DynamicTableFilterSet::GetFinalTableFilters(optional_ptr<TableFilterSet> existing_filters) const {
+	D_ASSERT(HasFilters());
+	auto result = existing_filters ? existing_filters->Copy() : make_uniq<TableFilterSet>();
+	lock_guard<mutex> l(lock);
+	for (auto &entry : filters) {
+		for (auto &filter : entry.second->filters) {
+			result->PushFilter(filter.first, filter.second->Copy());
+		}
+	}
+	return result;
+}
+
 } // namespace duckdb
@@ -9,6 +9,10 @@ CompressionType RowGroupWriter::GetColumnCompressionType(idx_t i) {
 	return table.GetColumn(LogicalIndex(i)).CompressionType();
 }
 
+bool RowGroupWriter::ColumnHasBloomFilter(idx_t i) {
+	return table.GetColumns().GetColumn(PhysicalIndex(i)).HasBloomFilter();
+}
+
 SingleFileRowGroupWriter::SingleFileRowGroupWriter(TableCatalogEntry &table, PartialBlockManager &partial_block_manager,
                                                    TableDataWriter &writer, MetadataWriter &table_data_writer)
     : RowGroupWriter(table, partial_block_manager), writer(writer), table_data_writer(table_data_writer) {
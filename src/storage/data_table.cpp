@@ -371,9 +371,10 @@ TableStorageInfo DataTable::GetStorageInfo() {
 // Fetch
 //===--------------------------------------------------------------------===//
 void DataTable::Fetch(DuckTransaction &transaction, DataChunk &result, const vector<column_t> &column_ids,
-                      const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state) {
+                      const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state,
+                      optional_ptr<SelectionVector> fetched_sel) {
 	auto lock = info->checkpoint_lock.GetSharedLock();
-	row_groups->Fetch(transaction, result, column_ids, row_identifiers, fetch_count, state);
+	row_groups->Fetch(transaction, result, column_ids, row_identifiers, fetch_count, state, fetched_sel);
 }
 
 //===--------------------------------------------------------------------===//
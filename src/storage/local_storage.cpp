@@ -553,13 +553,14 @@ void LocalStorage::ChangeType(DataTable &old_dt, DataTable &new_dt, idx_t change
 }
 
 void LocalStorage::FetchChunk(DataTable &table, Vector &row_ids, idx_t count, const vector<column_t> &col_ids,
-                              DataChunk &chunk, ColumnFetchState &fetch_state) {
+                              DataChunk &chunk, ColumnFetchState &fetch_state,
+                              optional_ptr<SelectionVector> fetched_sel) {
 	auto storage = table_manager.GetStorage(table);
 	if (!storage) {
 		throw InternalException("LocalStorage::FetchChunk - local storage not found");
 	}
 
-	storage->row_groups->Fetch(transaction, chunk, col_ids, row_ids, count, fetch_state);
+	storage->row_groups->Fetch(transaction, chunk, col_ids, row_ids, count, fetch_state, fetched_sel);
 }
 
 TableIndexList &LocalStorage::GetIndexes(DataTable &table) {
@@ -10,6 +10,8 @@
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 
 namespace duckdb {
 
@@ -21,6 +23,9 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	auto filter_type = deserializer.ReadProperty<TableFilterType>(100, "filter_type");
 	unique_ptr<TableFilter> result;
 	switch (filter_type) {
+	case TableFilterType::BLOOM_FILTER:
+		result = BloomTableFilter::Deserialize(deserializer);
+		break;
 	case TableFilterType::CONJUNCTION_AND:
 		result = ConjunctionAndFilter::Deserialize(deserializer);
 		break;
@@ -30,6 +35,9 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	case TableFilterType::CONSTANT_COMPARISON:
 		result = ConstantFilter::Deserialize(deserializer);
 		break;
+	case TableFilterType::IN_FILTER:
+		result = InFilter::Deserialize(deserializer);
+		break;
 	case TableFilterType::IS_NOT_NULL:
 		result = IsNotNullFilter::Deserialize(deserializer);
 		break;
@@ -45,6 +53,19 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	return result;
 }
 
+void BloomTableFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WriteProperty<BloomFilter>(200, "filter", filter);
+	serializer.WritePropertyWithDefault<idx_t>(201, "key_count", key_count);
+}
+
+unique_ptr<TableFilter> BloomTableFilter::Deserialize(Deserializer &deserializer) {
+	auto filter = deserializer.ReadProperty<BloomFilter>(200, "filter");
+	auto key_count = deserializer.ReadPropertyWithDefault<idx_t>(201, "key_count");
+	auto result = duckdb::unique_ptr<BloomTableFilter>(new BloomTableFilter(filter, key_count));
+	return std::move(result);
+}
+
 void ConjunctionAndFilter::Serialize(Serializer &serializer) const {
 	TableFilter::Serialize(serializer);
 	serializer.WritePropertyWithDefault<vector<unique_ptr<TableFilter>>>(200, "child_filters", child_filters);
@@ -80,6 +101,17 @@ unique_ptr<TableFilter> ConstantFilter::Deserialize(Deserializer &deserializer)
 	return std::move(result);
 }
 
+void InFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WritePropertyWithDefault<vector<Value>>(200, "values", values);
+}
+
+unique_ptr<TableFilter> InFilter::Deserialize(Deserializer &deserializer) {
+	auto values = deserializer.ReadPropertyWithDefault<vector<Value>>(200, "values");
+	auto result = duckdb::unique_ptr<InFilter>(new InFilter(std::move(values)));
+	return std::move(result);
+}
+
 void IsNotNullFilter::Serialize(Serializer &serializer) const {
 	TableFilter::Serialize(serializer);
 }
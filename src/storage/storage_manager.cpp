@@ -2,6 +2,7 @@
 
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/function/function.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -15,6 +16,7 @@
 #include "duckdb/transaction/transaction_manager.hpp"
 
 #include "duckdb/storage/storage_extension.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 
@@ -201,14 +203,34 @@ void SingleFileStorageManager::LoadDatabase() {
 		auto wal_path = GetWALPath();
 		auto handle = fs.OpenFile(wal_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
 		if (handle) {
+			// the WAL replay appends to different tables in parallel: make sure the worker threads are running
+			auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+			scheduler.SetThreads(config.options.maximum_threads, config.options.external_threads);
+			scheduler.RelaunchThreads();
+
 			// replay the WAL
-			if (WriteAheadLog::Replay(db, std::move(handle))) {
+			Profiler profiler;
+			profiler.Start();
+			if (WriteAheadLog::Replay(db, std::move(handle), wal_replay_info)) {
 				fs.RemoveFile(wal_path);
 			}
+			profiler.End();
+			wal_replay_info.replay_time = profiler.Elapsed();
 		}
 	}
 
 	load_complete = true;
+
+	if (wal_replay_info.transaction_count > 0 && !read_only && config.options.checkpoint_after_wal_replay) {
+		// write the replayed changes to the database file right away, so the WAL does not need to be replayed again
+		Profiler profiler;
+		profiler.Start();
+		CheckpointOptions options;
+		options.wal_action = CheckpointWALAction::DELETE_WAL;
+		CreateCheckpoint(options);
+		profiler.End();
+		wal_replay_info.checkpoint_time = profiler.Elapsed();
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -218,6 +240,7 @@ class SingleFileStorageCommitState : public StorageCommitState {
 	idx_t initial_written = 0;
 	optional_ptr<WriteAheadLog> log;
 	bool checkpoint;
+	bool group_commit;
 
 public:
 	SingleFileStorageCommitState(StorageManager &storage_manager, bool checkpoint);
@@ -238,7 +261,7 @@ public:
 };
 
 SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage_manager, bool checkpoint)
-    : checkpoint(checkpoint) {
+    : checkpoint(checkpoint), group_commit(DBConfig::Get(storage_manager.GetAttached()).options.wal_group_commit) {
 
 	log = storage_manager.GetWAL();
 	if (!log) {
@@ -264,7 +287,12 @@ void SingleFileStorageCommitState::FlushCommit() {
 			(void)checkpoint;
 			D_ASSERT(!checkpoint);
 			D_ASSERT(!log->skip_writing);
-			log->Flush();
+			if (group_commit) {
+				// the WAL is synced by the transaction manager after the commit, together with concurrent commits
+				log->GroupCommitFlush();
+			} else {
+				log->Flush();
+			}
 		}
 		log->skip_writing = false;
 	}
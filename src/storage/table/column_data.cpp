@@ -328,6 +328,31 @@ unique_ptr<BaseStatistics> ColumnData::GetStatistics() {
 	return stats->statistics.ToUnique();
 }
 
+unique_ptr<BaseStatistics> ColumnData::GetCheckpointStatistics() {
+	if (type.IsNested() || HasUpdates()) {
+		return nullptr;
+	}
+	// the statistics of the persistent segments are the ones written by the checkpoint
+	auto result = BaseStatistics::CreateEmpty(type).ToUnique();
+	idx_t segment_count = 0;
+	auto segment = data.GetRootSegment();
+	while (segment) {
+		if (segment->segment_type != ColumnSegmentType::PERSISTENT) {
+			return nullptr;
+		}
+		{
+			lock_guard<mutex> l(stats_lock);
+			result->Merge(segment->stats.statistics);
+		}
+		segment_count += segment->count;
+		segment = data.GetNextSegment(segment);
+	}
+	if (segment_count != count) {
+		return nullptr;
+	}
+	return result;
+}
+
 void ColumnData::MergeStatistics(const BaseStatistics &other) {
 	if (!stats) {
 		throw InternalException("ColumnData::MergeStatistics called on a column without stats");
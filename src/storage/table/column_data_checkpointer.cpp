@@ -1,5 +1,6 @@
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/parser/column_definition.hpp"
@@ -197,9 +198,15 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	auto best_function = compression_functions[compression_idx];
 	auto compress_state = best_function->init_compression(*this, std::move(analyze_state));
 
-	ScanSegments(
-	    [&](Vector &scan_vector, idx_t count) { best_function->compress(*compress_state, scan_vector, count); });
+	auto bloom_filter = HasBloomFilter() ? make_shared_ptr<BloomFilter>(row_group.count.load()) : nullptr;
+	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		if (bloom_filter) {
+			bloom_filter->Insert(scan_vector, count);
+		}
+		best_function->compress(*compress_state, scan_vector, count);
+	});
 	best_function->compress_finalize(*compress_state);
+	state.bloom_filter = std::move(bloom_filter);
 
 	nodes.clear();
 }
@@ -250,12 +257,26 @@ void ColumnDataCheckpointer::WritePersistentSegments() {
 	}
 }
 
+bool ColumnDataCheckpointer::HasBloomFilter() {
+	// bloom filters are only constructed for the top-level data of non-nested columns
+	return checkpoint_info.HasBloomFilter() && !is_validity && !col_data.parent && !GetType().IsNested();
+}
+
 void ColumnDataCheckpointer::Checkpoint(vector<SegmentNode<ColumnSegment>> nodes_p) {
 	D_ASSERT(!nodes_p.empty());
 	this->nodes = std::move(nodes_p);
 	// first check if any of the segments have changes
 	if (!HasChanges()) {
 		// no changes: only need to write the metadata for this column
+		if (HasBloomFilter()) {
+			// re-use the existing bloom filter - or construct it if there is none
+			state.bloom_filter = row_group.GetBloomFilter(checkpoint_info.column_idx);
+			if (!state.bloom_filter) {
+				auto bloom_filter = make_shared_ptr<BloomFilter>(row_group.count.load());
+				ScanSegments([&](Vector &scan_vector, idx_t count) { bloom_filter->Insert(scan_vector, count); });
+				state.bloom_filter = std::move(bloom_filter);
+			}
+		}
 		WritePersistentSegments();
 	} else {
 		// there are changes: rewrite the set of columns);
@@ -20,7 +20,11 @@
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 
 namespace duckdb {
@@ -44,6 +48,13 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
 	}
 	this->deletes_pointers = std::move(pointer.deletes_pointers);
 	this->deletes_is_loaded = false;
+	if (!pointer.bloom_filter_pointers.empty()) {
+		if (pointer.bloom_filter_pointers.size() != columns.size()) {
+			throw IOException("Row group bloom filter count is unaligned with table column count. Corrupt file?");
+		}
+		this->bloom_filter_pointers = std::move(pointer.bloom_filter_pointers);
+		this->bloom_filters.resize(columns.size());
+	}
 
 	Verify();
 }
@@ -179,6 +190,9 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 			return false;
 		}
 	}
+	if (vector_offset == 0 && AggregateStatistics(state)) {
+		return false;
+	}
 
 	state.row_group = this;
 	state.vector_index = vector_offset;
@@ -211,6 +225,9 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 			return false;
 		}
 	}
+	if (AggregateStatistics(state)) {
+		return false;
+	}
 	state.row_group = this;
 	state.vector_index = 0;
 	state.max_row_group_row =
@@ -366,10 +383,104 @@ bool RowGroup::CheckZonemap(TableFilterSet &filters, const vector<storage_t> &co
 		if (!GetColumn(base_column_index).CheckZonemap(*filter)) {
 			return false;
 		}
+		if (!CheckBloomFilter(base_column_index, *filter)) {
+			return false;
+		}
 	}
 	return true;
 }
 
+static bool CanUseBloomFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return filter.Cast<ConstantFilter>().comparison_type == ExpressionType::COMPARE_EQUAL;
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (CanUseBloomFilter(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Returns true if none of the values that pass the filter can be in the bloom filter
+static bool BloomFilterExcludes(const BloomFilter &bloom_filter, const TableFilter &filter, const LogicalType &type) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL || constant_filter.constant.type() != type) {
+			return false;
+		}
+		return !bloom_filter.Lookup(constant_filter.constant.Hash());
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			if (value.type() != type || bloom_filter.Lookup(value.Hash())) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (BloomFilterExcludes(bloom_filter, *child_filter, type)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+bool RowGroup::CheckBloomFilter(idx_t column_idx, const TableFilter &filter) {
+	if (!CanUseBloomFilter(filter)) {
+		return true;
+	}
+	auto bloom_filter = GetBloomFilter(column_idx);
+	if (!bloom_filter) {
+		return true;
+	}
+	auto &type = GetCollection().GetTypes()[column_idx];
+	return !BloomFilterExcludes(*bloom_filter, filter, type);
+}
+
+shared_ptr<BloomFilter> RowGroup::GetBloomFilter(idx_t column_idx) {
+	lock_guard<mutex> l(row_group_lock);
+	if (bloom_filters.empty()) {
+		return nullptr;
+	}
+	D_ASSERT(column_idx < bloom_filters.size());
+	if (!bloom_filter_pointers.empty() && bloom_filter_pointers[column_idx].IsValid()) {
+		// the bloom filter has not been loaded yet - load it from disk
+		auto &metadata_manager = GetCollection().GetMetadataManager();
+		MetadataReader reader(metadata_manager, bloom_filter_pointers[column_idx]);
+		BinaryDeserializer deserializer(reader);
+		deserializer.Begin();
+		bloom_filters[column_idx] = make_shared_ptr<BloomFilter>(BloomFilter::Deserialize(deserializer));
+		deserializer.End();
+		bloom_filter_pointers[column_idx] = MetaBlockPointer();
+	}
+	return bloom_filters[column_idx];
+}
+
+void RowGroup::InvalidateBloomFilters() {
+	lock_guard<mutex> l(row_group_lock);
+	bloom_filters.clear();
+	bloom_filter_pointers.clear();
+	bloom_filter_version++;
+}
+
 static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	switch (filter.filter_type) {
 	case TableFilterType::STRUCT_EXTRACT: {
@@ -397,6 +508,8 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::IN_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -404,6 +517,63 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	}
 }
 
+bool RowGroup::AggregateStatistics(CollectionScanState &state) {
+	auto aggregate_stats = state.GetOptions().aggregate_statistics;
+	if (!aggregate_stats || count == 0 || start + count > state.max_row) {
+		return false;
+	}
+	auto &column_ids = state.GetColumnIds();
+	vector<unique_ptr<BaseStatistics>> column_stats;
+	for (auto &column_idx : aggregate_stats->columns) {
+		if (column_idx == DConstants::INVALID_INDEX) {
+			column_stats.push_back(nullptr);
+			continue;
+		}
+		auto column_id = column_ids[column_idx];
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			return false;
+		}
+		auto stats = GetColumn(column_id).GetCheckpointStatistics();
+		if (!stats || stats->GetStatsType() != StatisticsType::NUMERIC_STATS || !NumericStats::HasMinMax(*stats)) {
+			return false;
+		}
+		column_stats.push_back(std::move(stats));
+	}
+	// the filters have to be true for all rows, the statistics do not consider NULL values
+	auto filters = state.GetFilters();
+	if (filters) {
+		for (auto &entry : filters->filters) {
+			auto column_id = column_ids[entry.first];
+			if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+				return false;
+			}
+			auto stats = GetColumn(column_id).GetCheckpointStatistics();
+			if (!stats) {
+				return false;
+			}
+			auto &filter = *entry.second;
+			if (filter.CheckStatistics(*stats) != FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+				return false;
+			}
+			if (stats->CanHaveNull() && filter.filter_type != TableFilterType::IS_NULL) {
+				return false;
+			}
+		}
+	}
+	// all rows have to be visible to the transaction
+	auto transaction = aggregate_stats->GetTransaction();
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t vector_count = (count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+	for (idx_t vector_idx = 0; vector_idx < vector_count; vector_idx++) {
+		idx_t max_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - vector_idx * STANDARD_VECTOR_SIZE);
+		if (GetSelVector(transaction, vector_idx, sel, max_count) != max_count) {
+			return false;
+		}
+	}
+	aggregate_stats->AddRowGroup(count, column_stats);
+	return true;
+}
+
 bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 	auto &column_ids = state.GetColumnIds();
 	auto filters = state.GetFilters();
@@ -723,6 +893,8 @@ void RowGroup::RevertAppend(idx_t row_group_start) {
 }
 
 void RowGroup::InitializeAppend(RowGroupAppendState &append_state) {
+	// the bloom filters do not contain the appended values
+	InvalidateBloomFilters();
 	append_state.row_group = this;
 	append_state.offset_in_row_group = this->count;
 	// for each column, initialize the append state
@@ -752,6 +924,7 @@ void RowGroup::Update(TransactionData transaction, DataChunk &update_chunk, row_
 		D_ASSERT(ids[i] >= row_t(this->start) && ids[i] < row_t(this->start + this->count));
 	}
 #endif
+	InvalidateBloomFilters();
 	for (idx_t i = 0; i < column_ids.size(); i++) {
 		auto column = column_ids[i];
 		D_ASSERT(column.index != COLUMN_IDENTIFIER_ROW_ID);
@@ -776,6 +949,7 @@ void RowGroup::UpdateColumn(TransactionData transaction, DataChunk &updates, Vec
 	auto primary_column_idx = column_path[0];
 	D_ASSERT(primary_column_idx != COLUMN_IDENTIFIER_ROW_ID);
 	D_ASSERT(primary_column_idx < columns.size());
+	InvalidateBloomFilters();
 	auto &col_data = GetColumn(primary_column_idx);
 	col_data.UpdateColumn(transaction, column_path, updates.data[0], ids, updates.size(), 1);
 	MergeStatistics(primary_column_idx, *col_data.GetUpdateStatistics());
@@ -800,10 +974,18 @@ CompressionType ColumnCheckpointInfo::GetCompressionType() {
 	return info.compression_types[column_idx];
 }
 
+bool ColumnCheckpointInfo::HasBloomFilter() {
+	return column_idx < info.bloom_filter_columns.size() && info.bloom_filter_columns[column_idx];
+}
+
 RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	RowGroupWriteData result;
 	result.states.reserve(columns.size());
 	result.statistics.reserve(columns.size());
+	{
+		lock_guard<mutex> l(row_group_lock);
+		result.bloom_filter_version = bloom_filter_version;
+	}
 
 	// Checkpoint the individual columns of the row group
 	// Here we're iterating over columns. Each column can have multiple segments.
@@ -848,7 +1030,9 @@ bool RowGroup::HasUnloadedDeletes() const {
 
 RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 	vector<CompressionType> compression_types;
+	vector<bool> bloom_filter_columns;
 	compression_types.reserve(columns.size());
+	bloom_filter_columns.reserve(columns.size());
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
 		auto &column = GetColumn(column_idx);
 		if (column.count != this->count) {
@@ -857,9 +1041,11 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 			                        column_idx, this->count.load(), column.count.load());
 		}
 		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
+		bloom_filter_columns.push_back(writer.ColumnHasBloomFilter(column_idx));
 	}
 
 	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, writer.GetCheckpointType());
+	info.bloom_filter_columns = std::move(bloom_filter_columns);
 	return WriteToDisk(info);
 }
 
@@ -893,6 +1079,34 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 		state->WriteDataPointers(writer, serializer);
 		serializer.End();
 	}
+	// write the bloom filters of the columns (if any)
+	bool has_bloom_filters = false;
+	for (auto &state : write_data.states) {
+		has_bloom_filters = has_bloom_filters || state->bloom_filter;
+	}
+	if (has_bloom_filters) {
+		vector<shared_ptr<BloomFilter>> new_bloom_filters;
+		for (auto &state : write_data.states) {
+			new_bloom_filters.push_back(state->bloom_filter);
+			if (!state->bloom_filter) {
+				row_group_pointer.bloom_filter_pointers.emplace_back();
+				continue;
+			}
+			auto &data_writer = writer.GetPayloadWriter();
+			row_group_pointer.bloom_filter_pointers.push_back(data_writer.GetMetaBlockPointer());
+
+			BinarySerializer serializer(data_writer);
+			serializer.Begin();
+			state->bloom_filter->Serialize(serializer);
+			serializer.End();
+		}
+		// keep the new bloom filters around - unless the row group was modified while it was being written
+		lock_guard<mutex> l(row_group_lock);
+		if (bloom_filter_version == write_data.bloom_filter_version) {
+			bloom_filters = std::move(new_bloom_filters);
+			bloom_filter_pointers.clear();
+		}
+	}
 	row_group_pointer.deletes_pointers = CheckpointDeletes(writer.GetPayloadWriter().GetManager());
 	Verify();
 	return row_group_pointer;
@@ -917,6 +1131,7 @@ void RowGroup::Serialize(RowGroupPointer &pointer, Serializer &serializer) {
 	serializer.WriteProperty(101, "tuple_count", pointer.tuple_count);
 	serializer.WriteProperty(102, "data_pointers", pointer.data_pointers);
 	serializer.WriteProperty(103, "delete_pointers", pointer.deletes_pointers);
+	serializer.WritePropertyWithDefault(104, "bloom_filter_pointers", pointer.bloom_filter_pointers);
 }
 
 RowGroupPointer RowGroup::Deserialize(Deserializer &deserializer) {
@@ -925,6 +1140,8 @@ RowGroupPointer RowGroup::Deserialize(Deserializer &deserializer) {
 	result.tuple_count = deserializer.ReadProperty<uint64_t>(101, "tuple_count");
 	result.data_pointers = deserializer.ReadProperty<vector<MetaBlockPointer>>(102, "data_pointers");
 	result.deletes_pointers = deserializer.ReadProperty<vector<MetaBlockPointer>>(103, "delete_pointers");
+	result.bloom_filter_pointers =
+	    deserializer.ReadPropertyWithDefault<vector<MetaBlockPointer>>(104, "bloom_filter_pointers");
 	return result;
 }
 
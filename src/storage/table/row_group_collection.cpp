@@ -262,7 +262,8 @@ bool RowGroupCollection::Scan(DuckTransaction &transaction, const std::function<
 // Fetch
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::Fetch(TransactionData transaction, DataChunk &result, const vector<column_t> &column_ids,
-                               const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state) {
+                               const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state,
+                               optional_ptr<SelectionVector> fetched_sel) {
 	// figure out which row_group to fetch from
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
 	idx_t count = 0;
@@ -282,6 +283,9 @@ void RowGroupCollection::Fetch(TransactionData transaction, DataChunk &result, c
 			continue;
 		}
 		row_group->FetchRow(transaction, state, column_ids, row_id, result, count);
+		if (fetched_sel) {
+			fetched_sel->set_index(count, i);
+		}
 		count++;
 	}
 	result.SetCardinality(count);
@@ -1004,6 +1008,8 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		auto pointer =
 		    row_group.Checkpoint(std::move(checkpoint_state.write_data[segment_idx]), *row_group_writer, global_stats);
 		writer.AddRowGroup(std::move(pointer), std::move(row_group_writer));
+		// the next row group might have been vacuumed - it is linked again when (and if) it is appended
+		entry.node->next = nullptr;
 		row_groups->AppendSegment(l, std::move(entry.node));
 		new_total_rows += row_group.count;
 	}
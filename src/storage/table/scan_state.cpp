@@ -80,6 +80,40 @@ CollectionScanState::CollectionScanState(TableScanState &parent_p)
       parent(parent_p) {
 }
 
+ScanAggregateStatistics::ScanAggregateStatistics(vector<idx_t> columns_p)
+    : columns(std::move(columns_p)), transaction(0, 0), row_count(0) {
+	statistics.resize(columns.size());
+}
+
+void ScanAggregateStatistics::Initialize(TransactionData transaction_p) {
+	lock_guard<mutex> guard(lock);
+	transaction = transaction_p;
+	row_count = 0;
+	statistics.clear();
+	statistics.resize(columns.size());
+}
+
+void ScanAggregateStatistics::AddRowGroup(idx_t count, vector<unique_ptr<BaseStatistics>> &column_stats) {
+	D_ASSERT(column_stats.size() == columns.size());
+	lock_guard<mutex> guard(lock);
+	row_count += count;
+	for (idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+		if (!column_stats[col_idx]) {
+			continue;
+		}
+		if (!statistics[col_idx]) {
+			statistics[col_idx] = std::move(column_stats[col_idx]);
+		} else {
+			statistics[col_idx]->Merge(*column_stats[col_idx]);
+		}
+	}
+}
+
+optional_ptr<BaseStatistics> ScanAggregateStatistics::GetStatistics(idx_t column_idx) const {
+	D_ASSERT(column_idx < statistics.size());
+	return statistics[column_idx].get();
+}
+
 bool CollectionScanState::Scan(DuckTransaction &transaction, DataChunk &result) {
 	while (row_group) {
 		row_group->Scan(transaction, *this, result);
@@ -162,6 +162,20 @@ unique_ptr<BaseStatistics> StandardColumnData::GetUpdateStatistics() {
 	return stats;
 }
 
+unique_ptr<BaseStatistics> StandardColumnData::GetCheckpointStatistics() {
+	auto stats = ColumnData::GetCheckpointStatistics();
+	if (!stats) {
+		return nullptr;
+	}
+	// the validity tracks the NULL values of the column
+	auto validity_stats = validity.GetCheckpointStatistics();
+	if (!validity_stats) {
+		return nullptr;
+	}
+	stats->Merge(*validity_stats);
+	return stats;
+}
+
 void StandardColumnData::FetchRow(TransactionData transaction, ColumnFetchState &state, row_t row_id, Vector &result,
                                   idx_t result_idx) {
 	// find the segment the row belongs to
@@ -1,17 +1,22 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/common/checksum.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
+#include "lz4.hpp"
+
 namespace duckdb {
 
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), manager(&manager), block_size(block_size) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr), block_size(0) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -57,8 +62,11 @@ bool BlockIndexManager::HasFreeBlocks() {
 	return !free_indexes.empty();
 }
 
+idx_t BlockIndexManager::GetUsedBlockCount() {
+	return indexes_in_use.size();
+}
+
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMPFILE_BLOCK_SIZE = Storage::BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +74,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -94,11 +102,20 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string GetTemporaryFileName(idx_t index, idx_t slot_size) {
+	if (slot_size == Storage::BLOCK_ALLOC_SIZE) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	// files with compressed blocks are named after the size of their slots
+	return "duckdb_temp_storage_" + to_string(slot_size / 1024) + "K-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+                                         idx_t index, TemporaryFileManager &manager, idx_t slot_size)
+    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), slot_size(slot_size), db(db),
+      file_index(index),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, GetTemporaryFileName(index, slot_size))),
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -119,14 +136,63 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 
 void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+	D_ASSERT(slot_size == Storage::BLOCK_ALLOC_SIZE);
+	// compute the checksum and write it to the start of the buffer
+	uint64_t checksum = Checksum(buffer.buffer, buffer.size);
+	Store<uint64_t>(checksum, buffer.InternalBuffer());
 	buffer.Write(*handle, GetPositionInFile(index.block_index));
 }
 
+void TemporaryFileHandle::WriteTemporaryFile(AllocatedData &compressed_block, TemporaryFileIndex index) {
+	D_ASSERT(compressed_block.GetSize() >= slot_size);
+	handle->Write(compressed_block.get(), slot_size, GetPositionInFile(index.block_index));
+}
+
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle,
-	                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
-	                                                          std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto position = GetPositionInFile(block_index);
+	if (slot_size == Storage::BLOCK_ALLOC_SIZE) {
+		auto buffer = StandardBufferManager::ReadTemporaryBufferInternal(
+		    buffer_manager, *handle, position, Storage::BLOCK_SIZE, std::move(reusable_buffer));
+		// verify the checksum
+		auto stored_checksum = Load<uint64_t>(buffer->InternalBuffer());
+		uint64_t computed_checksum = Checksum(buffer->buffer, buffer->size);
+		if (stored_checksum != computed_checksum) {
+			throw IOException("Corrupt temporary file \"%s\": computed checksum %llu does not match stored checksum "
+			                  "%llu in block at location %llu",
+			                  path, computed_checksum, stored_checksum, position);
+		}
+		return buffer;
+	}
+
+	// read the compressed block
+	auto compressed_block = Allocator::Get(db).Allocate(slot_size);
+	handle->Read(compressed_block.get(), slot_size, position);
+	auto compressed_size = Load<uint64_t>(compressed_block.get());
+	auto stored_checksum = Load<uint64_t>(compressed_block.get() + sizeof(uint64_t));
+	if (compressed_size > slot_size - TemporaryFileManager::COMPRESSED_HEADER_SIZE) {
+		throw IOException("Corrupt temporary file \"%s\": compressed block at location %llu has invalid size %llu",
+		                  path, position, compressed_size);
+	}
+	auto compressed_data = compressed_block.get() + TemporaryFileManager::COMPRESSED_HEADER_SIZE;
+	uint64_t computed_checksum = Checksum(compressed_data, compressed_size);
+	if (stored_checksum != computed_checksum) {
+		throw IOException("Corrupt temporary file \"%s\": computed checksum %llu does not match stored checksum "
+		                  "%llu in block at location %llu",
+		                  path, computed_checksum, stored_checksum, position);
+	}
+
+	// decompress it into the buffer
+	auto buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(
+	    const_char_ptr_cast(compressed_data), char_ptr_cast(buffer->buffer), NumericCast<int>(compressed_size),
+	    NumericCast<int>(buffer->size));
+	if (decompressed_size < 0 || NumericCast<idx_t>(decompressed_size) != buffer->size) {
+		throw IOException("Corrupt temporary file \"%s\": failed to decompress block at location %llu", path,
+		                  position);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -154,6 +220,7 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	info.spilled_size = index_manager.GetUsedBlockCount() * Storage::BLOCK_ALLOC_SIZE;
 	return info;
 }
 
@@ -180,7 +247,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * Storage::BLOCK_ALLOC_SIZE;
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -266,7 +333,8 @@ static idx_t GetDefaultMax(const string &path) {
 }
 
 TemporaryFileManager::TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p)
-    : db(db), temp_directory(temp_directory_p), size_on_disk(0), max_swap_space(0) {
+    : db(db), temp_directory(temp_directory_p), size_on_disk(0), max_swap_space(0), compression_skip(0),
+      compression_backoff(0) {
 }
 
 TemporaryFileManager::~TemporaryFileManager() {
@@ -276,16 +344,62 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+idx_t TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_block) {
+	if (!DBConfig::GetConfig(db).options.temp_file_compression) {
+		return Storage::BLOCK_ALLOC_SIZE;
+	}
+	auto skip = compression_skip.load();
+	if (skip > 0 && compression_skip.compare_exchange_strong(skip, skip - 1)) {
+		// recent blocks were incompressible: don't spend time on compressing this block
+		return Storage::BLOCK_ALLOC_SIZE;
+	}
+	// the compressed block has to fit into a slot that is smaller than a block
+	auto max_slot_size = Storage::BLOCK_ALLOC_SIZE - COMPRESSED_SLOT_SIZE;
+	compressed_block = Allocator::Get(db).Allocate(max_slot_size);
+	auto compressed_data = compressed_block.get() + COMPRESSED_HEADER_SIZE;
+	auto compressed_size = duckdb_lz4::LZ4_compress_default(
+	    const_char_ptr_cast(buffer.buffer), char_ptr_cast(compressed_data), NumericCast<int>(buffer.size),
+	    NumericCast<int>(max_slot_size - COMPRESSED_HEADER_SIZE));
+	if (compressed_size <= 0) {
+		// the block is incompressible: skip compressing the next blocks, for longer if this happens repeatedly
+		compressed_block.Reset();
+		idx_t backoff = compression_backoff;
+		backoff = MinValue<idx_t>(MaxValue<idx_t>(backoff * 2, 1), idx_t(MAX_COMPRESSION_SKIP));
+		compression_backoff = backoff;
+		compression_skip = backoff;
+		return Storage::BLOCK_ALLOC_SIZE;
+	}
+	compression_backoff = 0;
+
+	// write the header and zero-initialize the remainder of the slot
+	auto used_size = COMPRESSED_HEADER_SIZE + NumericCast<idx_t>(compressed_size);
+	auto slot_size = AlignValue<idx_t, COMPRESSED_SLOT_SIZE>(used_size);
+	Store<uint64_t>(NumericCast<uint64_t>(compressed_size), compressed_block.get());
+	Store<uint64_t>(Checksum(compressed_data, NumericCast<idx_t>(compressed_size)),
+	                compressed_block.get() + sizeof(uint64_t));
+	memset(compressed_block.get() + used_size, 0, slot_size - used_size);
+	return slot_size;
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+	// compress the block if that makes it fit into a smaller slot
+	AllocatedData compressed_block;
+	auto slot_size = CompressBuffer(buffer, compressed_block);
+
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the same slot size
+		idx_t file_count = 0;
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
+			file_count++;
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -295,7 +409,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(file_count, db, temp_directory, new_file_index, *this, slot_size);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -306,7 +421,11 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	if (slot_size == Storage::BLOCK_ALLOC_SIZE) {
+		handle->WriteTemporaryFile(buffer, index);
+	} else {
+		handle->WriteTemporaryFile(compressed_block, index);
+	}
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -28,9 +28,31 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
+#include "duckdb/parallel/task_counter.hpp"
+#include "duckdb/storage/table/append_state.hpp"
 
 namespace duckdb {
 
+//! The chunks of consecutive inserts into a table, which are appended to the table together
+struct ReplayAppend {
+	explicit ReplayAppend(TableCatalogEntry &table) : table(table) {
+	}
+
+	TableCatalogEntry &table;
+	vector<unique_ptr<DataChunk>> chunks;
+	LocalAppendState append_state;
+	ErrorData error;
+
+	void Append(ClientContext &context) {
+		// we don't do any constraint verification here
+		auto &storage = table.GetStorage();
+		for (auto &chunk : chunks) {
+			storage.LocalAppend(append_state, table, context, *chunk, true);
+			chunk.reset();
+		}
+	}
+};
+
 class ReplayState {
 public:
 	ReplayState(AttachedDatabase &db, ClientContext &context) : db(db), context(context), catalog(db.GetCatalog()) {
@@ -42,6 +64,17 @@ public:
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+	//! The inserts that have not been appended to their tables yet, one entry per table
+	vector<unique_ptr<ReplayAppend>> pending_appends;
+	//! The number of rows in the pending inserts
+	idx_t pending_rows = 0;
+	//! The number of replayed transactions
+	idx_t transaction_count = 0;
+
+public:
+	void AddAppend(TableCatalogEntry &table, unique_ptr<DataChunk> chunk);
+	//! Appends the pending inserts to their tables, the inserts into different tables are appended in parallel
+	void FlushAppends();
 };
 
 class WriteAheadLogDeserializer {
@@ -97,6 +130,10 @@ public:
 	bool ReplayEntry() {
 		deserializer.Begin();
 		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
+		if (!DeserializeOnly() && wal_type != WALType::INSERT_TUPLE && wal_type != WALType::USE_TABLE) {
+			// inserts are appended lazily: append them before any entry that could depend on them
+			state.FlushAppends();
+		}
 		if (wal_type == WALType::WAL_FLUSH) {
 			deserializer.End();
 			return true;
@@ -158,10 +195,96 @@ private:
 	bool deserialize_only;
 };
 
+//===--------------------------------------------------------------------===//
+// Replay Appends
+//===--------------------------------------------------------------------===//
+class ReplayAppendTask : public Task {
+public:
+	ReplayAppendTask(TaskCounter &counter, ClientContext &context, ReplayAppend &append)
+	    : counter(counter), context(context), append(append) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			append.Append(context);
+			counter.FinishTask();
+			return TaskExecutionResult::TASK_FINISHED;
+		} catch (std::exception &ex) {
+			append.error = ErrorData(ex);
+		} catch (...) { // LCOV_EXCL_START
+			append.error = ErrorData("Unknown exception during WAL replay");
+		} // LCOV_EXCL_STOP
+		counter.FinishTask();
+		return TaskExecutionResult::TASK_ERROR;
+	}
+
+private:
+	TaskCounter &counter;
+	ClientContext &context;
+	ReplayAppend &append;
+};
+
+void ReplayState::AddAppend(TableCatalogEntry &table, unique_ptr<DataChunk> chunk) {
+	optional_ptr<ReplayAppend> append;
+	for (auto &pending : pending_appends) {
+		if (&pending->table == &table) {
+			append = pending.get();
+			break;
+		}
+	}
+	if (!append) {
+		pending_appends.push_back(make_uniq<ReplayAppend>(table));
+		append = pending_appends.back().get();
+	}
+	pending_rows += chunk->size();
+	append->chunks.push_back(std::move(chunk));
+
+	// bound the memory that is used by the pending inserts
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	if (pending_rows >= Storage::ROW_GROUP_SIZE * NumericCast<idx_t>(scheduler.NumberOfThreads())) {
+		FlushAppends();
+	}
+}
+
+void ReplayState::FlushAppends() {
+	if (pending_appends.empty()) {
+		return;
+	}
+	// initializing the appends uses the client context, so it is done by this thread
+	for (auto &append : pending_appends) {
+		vector<unique_ptr<BoundConstraint>> bound_constraints;
+		append->table.GetStorage().InitializeLocalAppend(append->append_state, append->table, context,
+		                                                 bound_constraints);
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	if (pending_appends.size() == 1 || scheduler.NumberOfThreads() == 1) {
+		for (auto &append : pending_appends) {
+			append->Append(context);
+		}
+	} else {
+		// every table has its own transaction-local storage: the tables can be appended to in parallel
+		TaskCounter counter(scheduler);
+		for (auto &append : pending_appends) {
+			counter.AddTask(make_shared_ptr<ReplayAppendTask>(counter, context, *append));
+		}
+		counter.Finish();
+		for (auto &append : pending_appends) {
+			if (append->error.HasError()) {
+				append->error.Throw();
+			}
+		}
+	}
+	for (auto &append : pending_appends) {
+		append->table.GetStorage().FinalizeLocalAppend(append->append_state);
+	}
+	pending_appends.clear();
+	pending_rows = 0;
+}
+
 //===--------------------------------------------------------------------===//
 // Replay
 //===--------------------------------------------------------------------===//
-bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> handle) {
+bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> handle, WALReplayInfo &info) {
 	Connection con(database.GetDatabase());
 	auto wal_path = handle->GetPath();
 	BufferedFileReader reader(FileSystem::Get(database), std::move(handle));
@@ -169,6 +292,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		// WAL is empty
 		return false;
 	}
+	info.wal_size = reader.FileSize();
 
 	con.BeginTransaction();
 	MetaTransaction::Get(*con.context).ModifyDatabase(database);
@@ -221,6 +345,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
 			if (deserializer.ReplayEntry()) {
 				con.Commit();
+				state.transaction_count++;
 				// check if the file is exhausted
 				if (reader.Finished()) {
 					// we finished reading the file: break
@@ -232,6 +357,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		}
 	} catch (std::exception &ex) { // LCOV_EXCL_START
 		// exception thrown in WAL replay: rollback
+		state.pending_appends.clear();
 		con.Query("ROLLBACK");
 		ErrorData error(ex);
 		// serialization failure means a truncated WAL
@@ -242,9 +368,11 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		}
 	} catch (...) {
 		// exception thrown in WAL replay: rollback
+		state.pending_appends.clear();
 		con.Query("ROLLBACK");
 		throw;
 	} // LCOV_EXCL_STOP
+	info.transaction_count = state.transaction_count;
 	return false;
 }
 
@@ -651,8 +779,8 @@ void WriteAheadLogDeserializer::ReplayUseTable() {
 }
 
 void WriteAheadLogDeserializer::ReplayInsert() {
-	DataChunk chunk;
-	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk.Deserialize(object); });
+	auto chunk = make_uniq<DataChunk>();
+	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk->Deserialize(object); });
 	if (DeserializeOnly()) {
 		return;
 	}
@@ -660,10 +788,8 @@ void WriteAheadLogDeserializer::ReplayInsert() {
 		throw InternalException("Corrupt WAL: insert without table");
 	}
 
-	// append to the current table
-	// we don't do any constraint verification here
-	vector<unique_ptr<BoundConstraint>> bound_constraints;
-	state.current_table->GetStorage().LocalAppend(*state.current_table, context, chunk, bound_constraints);
+	// append to the current table, together with the consecutive inserts into the same table
+	state.AddAppend(*state.current_table, std::move(chunk));
 }
 
 void WriteAheadLogDeserializer::ReplayDelete() {
@@ -16,12 +16,15 @@
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 
+#include <thread>
+
 namespace duckdb {
 
 const uint64_t WAL_VERSION_NUMBER = 2;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : skip_writing(false), database(database), wal_path(wal_path) {
+    : skip_writing(false), database(database), wal_path(wal_path), flushed_sequence(0), synced_sequence(0),
+      sync_in_progress(false) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
@@ -414,4 +417,52 @@ void WriteAheadLog::Flush() {
 	writer->Sync();
 }
 
+idx_t WriteAheadLog::GroupCommitFlush() {
+	if (skip_writing) {
+		return 0;
+	}
+	D_ASSERT(writer);
+
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// write the changes to the file, the sync is shared with the other commits in WaitForSync
+	writer->Flush();
+	return ++flushed_sequence;
+}
+
+void WriteAheadLog::WaitForSync(idx_t sequence) {
+	auto max_delay = DBConfig::Get(database).options.wal_group_commit_max_delay;
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_sequence < sequence) {
+		if (sync_in_progress) {
+			// another commit is syncing the WAL: wait for it to finish
+			sync_cv.wait(guard);
+			continue;
+		}
+		// no sync is in progress: this commit syncs the WAL for every commit that has been flushed so far
+		sync_in_progress = true;
+		guard.unlock();
+		if (max_delay > 0) {
+			// give concurrent commits the chance to join this sync
+			std::this_thread::sleep_for(std::chrono::microseconds(max_delay));
+		}
+		idx_t target = flushed_sequence;
+		try {
+			writer->handle->Sync();
+		} catch (std::exception &ex) {
+			guard.lock();
+			sync_in_progress = false;
+			sync_cv.notify_all();
+			ErrorData error(ex);
+			throw FatalException("Failed to sync the write-ahead log: %s", error.RawMessage());
+		}
+		guard.lock();
+		synced_sequence = MaxValue(synced_sequence, target);
+		sync_in_progress = false;
+		sync_cv.notify_all();
+	}
+}
+
 } // namespace duckdb
@@ -223,4 +223,8 @@ unique_ptr<StorageLockKey> DuckTransaction::TryGetCheckpointLock() {
 	return transaction_manager.TryUpgradeCheckpointLock(*write_lock);
 }
 
+unique_ptr<StorageLockKey> DuckTransaction::ReleaseWriteLock() {
+	return std::move(write_lock);
+}
+
 } // namespace duckdb
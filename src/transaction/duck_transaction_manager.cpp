@@ -8,6 +8,7 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection_manager.hpp"
@@ -52,9 +53,15 @@ Transaction &DuckTransactionManager::StartTransaction(ClientContext &context) {
 	// obtain the start time and transaction ID of this transaction
 	transaction_t start_time = current_start_timestamp++;
 	transaction_t transaction_id = current_transaction_id++;
+	if (!unsynced_commits.empty()) {
+		// the snapshot ends before the first commit that is not synced to the WAL yet
+		start_time = MinValue(start_time, *unsynced_commits.begin());
+	}
 	if (active_transactions.empty()) {
 		lowest_active_start = start_time;
 		lowest_active_id = transaction_id;
+	} else {
+		lowest_active_start = MinValue<transaction_t>(lowest_active_start, start_time);
 	}
 
 	// create the actual transaction
@@ -218,6 +225,12 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	unique_ptr<StorageLockKey> lock;
 	auto undo_properties = transaction.GetUndoProperties();
 	auto checkpoint_decision = CanCheckpoint(transaction, lock, undo_properties);
+	// with group commit the WAL is flushed by the commit, but synced after the transaction lock is released
+	optional_ptr<WriteAheadLog> group_commit_log;
+	if (!db.IsSystem()) {
+		group_commit_log = db.GetStorageManager().GetWAL();
+	}
+	idx_t flush_sequence = group_commit_log ? group_commit_log->GetFlushSequence() : 0;
 	// commit the UndoBuffer of the transaction
 	auto error = transaction.Commit(db, commit_id, checkpoint_decision.can_checkpoint);
 	if (error.HasError()) {
@@ -232,6 +245,17 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		// we won't checkpoint after all: unlock the checkpoint lock again
 		lock.reset();
 	}
+	unique_ptr<StorageLockKey> group_commit_lock;
+	if (group_commit_log && group_commit_log->GetFlushSequence() != flush_sequence) {
+		// this commit was flushed to the WAL but not synced yet
+		// keep the shared checkpoint lock of the transaction until the WAL is synced, so it is not reset meanwhile
+		flush_sequence = group_commit_log->GetFlushSequence();
+		group_commit_lock = transaction.ReleaseWriteLock();
+		// the commit is published once the WAL is synced, until then new transactions do not see it
+		unsynced_commits.insert(commit_id);
+	} else {
+		group_commit_log = nullptr;
+	}
 
 	// commit successful: remove the transaction id from the list of active transactions
 	// potentially resulting in garbage collection
@@ -250,6 +274,24 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		options.type = checkpoint_decision.type;
 		storage_manager.CreateCheckpoint(options);
 	}
+	if (group_commit_log) {
+		// sync the WAL together with the other transactions that committed meanwhile
+		if (tlock.owns_lock()) {
+			tlock.unlock();
+		}
+		ErrorData sync_error;
+		try {
+			group_commit_log->WaitForSync(flush_sequence);
+		} catch (std::exception &ex) {
+			sync_error = ErrorData(ex);
+		}
+		tlock.lock();
+		unsynced_commits.erase(commit_id);
+		tlock.unlock();
+		if (sync_error.HasError()) {
+			sync_error.Throw();
+		}
+	}
 	return error;
 }
 
@@ -275,6 +317,10 @@ void DuckTransactionManager::RemoveTransaction(DuckTransaction &transaction, boo
 	idx_t t_index = active_transactions.size();
 	// check for the lowest and highest start time in the list of transactions
 	transaction_t lowest_start_time = TRANSACTION_ID_START;
+	if (!unsynced_commits.empty()) {
+		// transactions that start before the sync can still need the versions overwritten by unsynced commits
+		lowest_start_time = *unsynced_commits.begin();
+	}
 	transaction_t lowest_transaction_id = MAX_TRANSACTION_ID;
 	transaction_t lowest_active_query = MAXIMUM_QUERY_ID;
 	for (idx_t i = 0; i < active_transactions.size(); i++) {
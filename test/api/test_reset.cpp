@@ -47,6 +47,9 @@ OptionValueSet &GetValueForOption(const string &name) {
 	static unordered_map<string, OptionValueSet> value_map = {
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
 	    {"checkpoint_threshold", {"4.0 GiB"}},
+	    {"wal_group_commit", {Value(true)}},
+	    {"wal_group_commit_max_delay", {Value::UBIGINT(100)}},
+	    {"checkpoint_after_wal_replay", {Value(true)}},
 	    {"debug_checkpoint_abort", {{"none", "before_truncate", "before_header", "after_free_list_write"}}},
 	    {"default_collation", {"nocase"}},
 	    {"default_order", {"desc"}},
@@ -58,6 +61,7 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"debug_force_external", {Value(true)}},
 	    {"old_implicit_casting", {Value(true)}},
 	    {"prefer_range_joins", {Value(true)}},
+	    {"force_index_join", {Value(true)}},
 	    {"allow_persistent_secrets", {Value(false)}},
 	    {"secret_directory", {"/tmp/some/path"}},
 	    {"enable_macro_dependencies", {Value(true)}},
@@ -96,6 +100,8 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"ordered_aggregate_threshold", {Value::UBIGINT(idx_t(1) << 12)}},
 	    {"null_order", {"nulls_first"}},
 	    {"perfect_ht_threshold", {0}},
+	    {"index_scan_max_count", {Value::UBIGINT(42)}},
+	    {"index_scan_percentage", {0.5}},
 	    {"pivot_filter_threshold", {999}},
 	    {"pivot_limit", {999}},
 	    {"partitioned_write_flush_threshold", {123}},
@@ -106,11 +112,13 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
 	    {"temp_directory", {"tmp"}},
+	    {"temp_file_compression", {false}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"worker_threads", {42}},
 	    {"enable_http_metadata_cache", {true}},
 	    {"force_bitpacking_mode", {"constant"}},
 	    {"allocator_flush_threshold", {"4.0 GiB"}},
+	    {"thread_pinning", {"cores"}},
 	    {"arrow_large_buffer_size", {true}},
 	    {"enable_http_logging", {true}},
 	    {"http_logging_output", {"my_cool_outputfile"}},
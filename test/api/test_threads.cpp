@@ -1,6 +1,8 @@
 #include "catch.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "test_helpers.hpp"
 
+#include <chrono>
 #include <thread>
 
 using namespace duckdb;
@@ -115,3 +117,86 @@ TEST_CASE("Test external threads", "[api]") {
 	REQUIRE(config.options.maximum_threads == std::thread::hardware_concurrency());
 	REQUIRE(db.NumberOfThreads() == std::thread::hardware_concurrency());
 }
+
+#ifndef DUCKDB_NO_THREADS
+//! A task that schedules child tasks from the thread it runs on, and then optionally blocks until it is released
+class StealingTestTask : public Task {
+public:
+	StealingTestTask(TaskScheduler &scheduler, ProducerToken &token, idx_t child_count, atomic<idx_t> &blocked_tasks,
+	                 atomic<bool> &released, atomic<idx_t> &finished_tasks)
+	    : scheduler(scheduler), token(token), child_count(child_count), blocked_tasks(blocked_tasks),
+	      released(released), finished_tasks(finished_tasks) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		if (child_count > 0) {
+			for (idx_t i = 0; i < child_count; i++) {
+				scheduler.ScheduleTask(token, make_shared_ptr<StealingTestTask>(scheduler, token, 0, blocked_tasks,
+				                                                                released, finished_tasks));
+			}
+			blocked_tasks++;
+			while (!released) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		}
+		finished_tasks++;
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	TaskScheduler &scheduler;
+	ProducerToken &token;
+	idx_t child_count;
+	atomic<idx_t> &blocked_tasks;
+	atomic<bool> &released;
+	atomic<idx_t> &finished_tasks;
+};
+
+TEST_CASE("Test fetching the tasks of a producer from the local deques of the background threads", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("SET threads=4"));
+	auto &scheduler = TaskScheduler::GetScheduler(*db.instance);
+	auto background_threads = NumericCast<idx_t>(scheduler.NumberOfThreads() - 1);
+	REQUIRE(background_threads == 3);
+
+	// every background thread runs a task that pushes its children onto the local deque of the thread, and blocks
+	constexpr idx_t CHILD_COUNT = 1000;
+	auto token = scheduler.CreateProducer();
+	atomic<idx_t> blocked_tasks(0);
+	atomic<bool> released(false);
+	atomic<idx_t> finished_tasks(0);
+	for (idx_t i = 0; i < background_threads; i++) {
+		scheduler.ScheduleTask(*token, make_shared_ptr<StealingTestTask>(scheduler, *token, CHILD_COUNT, blocked_tasks,
+		                                                                 released, finished_tasks));
+	}
+	while (blocked_tasks < background_threads) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	// a producer without tasks does not find any, regardless of the tasks of other producers in the local deques
+	auto idle_token = scheduler.CreateProducer();
+	shared_ptr<Task> task;
+	idx_t found_tasks = 0;
+	auto tmpdbg_start = std::chrono::steady_clock::now();
+	for (idx_t i = 0; i < 100000; i++) {
+		if (scheduler.GetTaskFromProducer(*idle_token, task)) {
+			found_tasks++;
+		}
+	}
+	fprintf(stderr, "TMPDBG misses %lld us\n", (long long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - tmpdbg_start).count());
+	REQUIRE(found_tasks == 0);
+
+	// the client thread can run all child tasks of its producer
+	while (scheduler.GetTaskFromProducer(*token, task)) {
+		task->Execute(TaskExecutionMode::PROCESS_ALL);
+		task.reset();
+	}
+	REQUIRE(finished_tasks == background_threads * CHILD_COUNT);
+
+	released = true;
+	while (finished_tasks < background_threads * (CHILD_COUNT + 1)) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+#endif
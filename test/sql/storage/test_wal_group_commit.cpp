@@ -0,0 +1,58 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+static void GroupCommitInsert(DuckDB *db, atomic<bool> *committed, bool *success) {
+	Connection con(*db);
+	*success = !con.Query("INSERT INTO integers VALUES (42)")->HasError();
+	*committed = true;
+}
+
+TEST_CASE("Test that group commits are not visible before the WAL is synced", "[storage]") {
+	duckdb::unique_ptr<QueryResult> result;
+	auto storage_database = TestCreatePath("group_commit_visibility");
+	auto config = GetTestConfig();
+	config->options.checkpoint_on_shutdown = false;
+
+	DeleteDatabase(storage_database);
+	DuckDB db(storage_database, config.get());
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA wal_autocheckpoint='1TB'"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+	REQUIRE_NO_FAIL(con.Query("SET wal_group_commit=true"));
+	// the syncing commit waits two seconds for other commits to join the sync
+	REQUIRE_NO_FAIL(con.Query("SET wal_group_commit_max_delay=2000000"));
+
+	atomic<bool> committed(false);
+	bool success = false;
+	thread insert_thread(GroupCommitInsert, &db, &committed, &success);
+	std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+	// the insert is flushed to the WAL, but it is not synced yet: neither a query nor a transaction that starts now
+	// can see it
+	Connection reader(db);
+	REQUIRE_NO_FAIL(reader.Query("BEGIN TRANSACTION"));
+	result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {0}));
+	result = reader.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {0}));
+	REQUIRE(!committed);
+
+	insert_thread.join();
+	REQUIRE(success);
+
+	// once the commit returns, the row is visible, except to the transaction that started before the sync
+	result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	result = reader.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {0}));
+	REQUIRE_NO_FAIL(reader.Query("COMMIT"));
+	result = reader.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+}